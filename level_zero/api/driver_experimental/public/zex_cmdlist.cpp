@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -70,4 +70,62 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernelBatch(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numLaunches,
+    const zex_kernel_launch_desc_t *pLaunches) {
+    hCommandList = toInternalType(hCommandList);
+    if (!hCommandList) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (numLaunches == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+    if (!pLaunches) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->appendLaunchKernelBatch(numLaunches, pLaunches, false);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    zex_command_list_handle_t hCommandList) {
+    hCommandList = toInternalType(hCommandList);
+    if (!hCommandList) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->beginGraphCapture();
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    zex_command_list_handle_t hCommandList,
+    zex_command_list_handle_t *phGraph) {
+    hCommandList = toInternalType(hCommandList);
+    if (!hCommandList || !phGraph) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->endGraphCapture(phGraph);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListCreateRecordingSegments(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numSegments,
+    zex_command_list_handle_t *phSegments) {
+    hCommandList = toInternalType(hCommandList);
+    if (!hCommandList) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (!phSegments) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->createRecordingSegments(numSegments, phSegments);
+}
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,4 +33,28 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+
+/// Launches are appended in order. When a launch fails, the launches preceding it remain appended
+/// (and are submitted on immediate command lists), the failing launch and the following ones are not,
+/// and the error of the failing launch is returned.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernelBatch(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numLaunches,
+    const zex_kernel_launch_desc_t *pLaunches);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    zex_command_list_handle_t hCommandList);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    zex_command_list_handle_t hCommandList,
+    zex_command_list_handle_t *phGraph);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListCreateRecordingSegments(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numSegments,
+    zex_command_list_handle_t *phSegments);
 } // namespace L0
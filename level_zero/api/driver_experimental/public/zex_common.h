@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,26 @@ typedef struct _zex_write_to_mem_desc_t {
     zex_mem_action_scope_flags_t writeScope;
 } zex_write_to_mem_desc_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kernel argument value applied before a batched launch
+typedef struct _zex_kernel_arg_value_t {
+    uint32_t argIndex;     ///< [in] argument index
+    size_t argSize;        ///< [in] size of the argument value
+    const void *pArgValue; ///< [in][optional] argument value, as passed to zeKernelSetArgumentValue
+} zex_kernel_arg_value_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Single kernel launch of zexCommandListAppendLaunchKernelBatch
+typedef struct _zex_kernel_launch_desc_t {
+    ze_kernel_handle_t hKernel;          ///< [in] kernel to launch
+    ze_group_count_t groupCount;         ///< [in] thread group launch arguments
+    uint32_t numArgs;                    ///< [in] number of entries in pArgs
+    const zex_kernel_arg_value_t *pArgs; ///< [in][optional] argument values set on hKernel before the launch
+    ze_event_handle_t hSignalEvent;      ///< [in][optional] event to signal on completion
+    uint32_t numWaitEvents;              ///< [in] number of events to wait on before launching
+    ze_event_handle_t *phWaitEvents;     ///< [in][optional] events to wait on before launching
+} zex_kernel_launch_desc_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef ZE_SYNCHRONIZED_DISPATCH_EXP_NAME
 /// @brief Synchronized Dispatch extension name
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,9 @@ enum class Builtin : uint32_t {
     copyBufferToBufferMiddle,
     copyBufferToBufferMiddleStateless,
     copyBufferToBufferMiddleStatelessHeapless,
+    copyBufferToBufferMiddleWide,
+    copyBufferToBufferMiddleWideStateless,
+    copyBufferToBufferMiddleWideStatelessHeapless,
     copyBufferToBufferSide,
     copyBufferToBufferSideStateless,
     copyBufferToBufferSideStatelessHeapless,
@@ -111,6 +114,16 @@ constexpr Builtin adjustBuiltinType<Builtin::copyBufferToBufferMiddle>(const boo
     return Builtin::copyBufferToBufferMiddle;
 }
 
+template <>
+constexpr Builtin adjustBuiltinType<Builtin::copyBufferToBufferMiddleWide>(const bool isStateless, const bool isHeapless) {
+    if (isHeapless) {
+        return Builtin::copyBufferToBufferMiddleWideStatelessHeapless;
+    } else if (isStateless) {
+        return Builtin::copyBufferToBufferMiddleWideStateless;
+    }
+    return Builtin::copyBufferToBufferMiddleWide;
+}
+
 template <>
 constexpr Builtin adjustBuiltinType<Builtin::copyBufferToBufferSide>(const bool isStateless, const bool isHeapless) {
     if (isHeapless) {
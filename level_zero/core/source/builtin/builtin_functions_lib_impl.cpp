@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,6 +62,18 @@ void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
         kernelName = "CopyBufferToBufferMiddleRegionStateless";
         builtin = NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless;
         break;
+    case Builtin::copyBufferToBufferMiddleWide:
+        kernelName = "CopyBufferToBufferMiddleRegionWide";
+        builtin = NEO::EBuiltInOps::copyBufferToBuffer;
+        break;
+    case Builtin::copyBufferToBufferMiddleWideStateless:
+        kernelName = "CopyBufferToBufferMiddleRegionWideStateless";
+        builtin = NEO::EBuiltInOps::copyBufferToBufferStateless;
+        break;
+    case Builtin::copyBufferToBufferMiddleWideStatelessHeapless:
+        kernelName = "CopyBufferToBufferMiddleRegionWideStateless";
+        builtin = NEO::EBuiltInOps::copyBufferToBufferStatelessHeapless;
+        break;
     case Builtin::copyBufferToBufferSide:
         kernelName = "CopyBufferToBufferSideRegion";
         builtin = NEO::EBuiltInOps::copyBufferToBuffer;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -192,13 +192,29 @@ void CommandList::eraseDeallocationContainerEntry(NEO::GraphicsAllocation *alloc
 }
 
 void CommandList::eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocation) {
-    std::vector<NEO::GraphicsAllocation *>::iterator allocErase;
-    auto container = &commandContainer.getResidencyContainer();
+    commandContainer.removeFromResidencyContainer(allocation);
+}
 
-    allocErase = std::find(container->begin(), container->end(), allocation);
-    if (allocErase != container->end()) {
-        container->erase(allocErase);
+bool CommandList::expandRecordingSegments(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists, std::vector<ze_command_list_handle_t> &expandedCommandLists) {
+    bool segmentsFound = false;
+    for (auto i = 0u; i < numCommandLists; i++) {
+        if (!CommandList::fromHandle(phCommandLists[i])->getRecordingSegments().empty()) {
+            segmentsFound = true;
+            break;
+        }
+    }
+    if (!segmentsFound) {
+        return false;
+    }
+
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        expandedCommandLists.push_back(phCommandLists[i]);
+        for (auto segment : commandList->getRecordingSegments()) {
+            expandedCommandLists.push_back(segment->toHandle());
+        }
     }
+    return true;
 }
 
 void CommandList::migrateSharedAllocations() {
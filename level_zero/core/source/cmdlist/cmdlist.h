@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,7 +19,9 @@
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include "level_zero/api/driver_experimental/public/zex_common.h"
 #include "level_zero/core/source/cmdlist/cmdlist_launch_params.h"
+#include "level_zero/core/source/cmdlist/cmdlist_mutable_commands.h"
 #include "level_zero/core/source/helpers/api_handle_helper.h"
 #include <level_zero/ze_api.h>
 #include <level_zero/zet_api.h>
@@ -112,6 +114,9 @@ struct CommandList : _ze_command_list_handle_t {
                                                             const uint32_t *pNumLaunchArguments,
                                                             const ze_group_count_t *pLaunchArgumentsBuffer, ze_event_handle_t hEvent,
                                                             uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) = 0;
+    virtual ze_result_t appendLaunchKernelBatch(uint32_t numLaunches, const zex_kernel_launch_desc_t *pLaunches, bool relaxedOrderingDispatch) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     virtual ze_result_t appendMemAdvise(ze_device_handle_t hDevice, const void *ptr, size_t size,
                                         ze_memory_advice_t advice) = 0;
     virtual ze_result_t appendMemoryCopy(void *dstptr, const void *srcptr, size_t size,
@@ -144,6 +149,30 @@ struct CommandList : _ze_command_list_handle_t {
 
     virtual void *asMutable() { return nullptr; };
 
+    virtual ze_result_t getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint64_t *pCommandId) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    virtual ze_result_t beginGraphCapture() {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t endGraphCapture(ze_command_list_handle_t *phGraph) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    virtual ze_result_t createRecordingSegments(uint32_t numSegments, ze_command_list_handle_t *phSegments) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
 
@@ -203,6 +232,15 @@ struct CommandList : _ze_command_list_handle_t {
     void forceDcFlushForDcFlushMitigation();
 
     void setOrdinal(uint32_t ord) { ordinal = ord; }
+
+    void enableMutableCommands() { mutableCommandsEnabled = true; }
+    bool isMutableCommandsEnabled() const { return mutableCommandsEnabled; }
+    bool isGraphCaptureActive() const { return graphCaptureTarget != nullptr; }
+    void markAsCapturedGraph() { capturedGraph = true; }
+    bool isCapturedGraph() const { return capturedGraph; }
+    bool isRecordingSegment() const { return recordingSegmentParent != nullptr; }
+    const std::vector<CommandList *> &getRecordingSegments() const { return recordingSegments; }
+    static bool expandRecordingSegments(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists, std::vector<ze_command_list_handle_t> &expandedCommandLists);
     void setCommandListPerThreadScratchSize(uint32_t slotId, uint32_t size) {
         UNRECOVERABLE_IF(slotId > 1);
         commandListPerThreadScratchSize[slotId] = size;
@@ -423,6 +461,7 @@ struct CommandList : _ze_command_list_handle_t {
     NEO::StreamProperties requiredStreamState{};
     NEO::StreamProperties finalStreamState{};
     CommandsToPatch commandsToPatch{};
+    MutableKernelDispatches mutableKernelDispatches;
     UnifiedMemoryControls unifiedMemoryControls;
     NEO::PrefetchContext prefetchContext;
     NEO::L1CachePolicy l1CachePolicyData{};
@@ -438,6 +477,9 @@ struct CommandList : _ze_command_list_handle_t {
     ze_context_handle_t hContext = nullptr;
     CommandQueue *cmdQImmediate = nullptr;
     CommandQueue *cmdQImmediateCopyOffload = nullptr;
+    CommandList *graphCaptureTarget = nullptr;
+    CommandList *recordingSegmentParent = nullptr;
+    std::vector<CommandList *> recordingSegments;
     Device *device = nullptr;
     NEO::ScratchSpaceController *usedScratchController = nullptr;
 
@@ -457,6 +499,7 @@ struct CommandList : _ze_command_list_handle_t {
     uint32_t partitionCount = 1;
     uint32_t defaultMocsIndex = 0;
     int32_t defaultPipelinedThreadArbitrationPolicy = NEO::ThreadArbitrationPolicy::NotPresent;
+    const void *mutableCommandStreamPosition = nullptr;
 
     bool isFlushTaskSubmissionEnabled = false;
     bool isSyncModeQueue = false;
@@ -494,6 +537,10 @@ struct CommandList : _ze_command_list_handle_t {
     bool statelessBuiltinsEnabled = false;
     bool localDispatchSupport = false;
     bool copyOperationOffloadEnabled = false;
+    bool mutableCommandsEnabled = false;
+    bool capturedGraph = false;
+    bool mutableCommandPending = false;
+    bool mutableCommandsClosed = false;
 };
 
 using CommandListAllocatorFn = CommandList *(*)(uint32_t);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -132,6 +132,7 @@ struct CommandListCoreFamily : public CommandListImp {
                                                     ze_event_handle_t hEvent,
                                                     uint32_t numWaitEvents,
                                                     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
+    ze_result_t appendLaunchKernelBatch(uint32_t numLaunches, const zex_kernel_launch_desc_t *pLaunches, bool relaxedOrderingDispatch) override;
     ze_result_t appendMemAdvise(ze_device_handle_t hDevice,
                                 const void *ptr, size_t size,
                                 ze_memory_advice_t advice) override;
@@ -213,6 +214,11 @@ struct CommandListCoreFamily : public CommandListImp {
     bool handleCounterBasedEventOperations(Event *signalEvent);
     bool isCbEventBoundToCmdList(Event *event) const;
 
+    ze_result_t getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint64_t *pCommandId) override;
+    ze_result_t updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) override;
+    ze_result_t updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) override;
+    ze_result_t updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+
   protected:
     MOCKABLE_VIRTUAL ze_result_t appendMemoryCopyKernelWithGA(void *dstPtr, NEO::GraphicsAllocation *dstPtrAlloc,
                                                               uint64_t dstOffset, void *srcPtr,
@@ -274,6 +280,8 @@ struct CommandListCoreFamily : public CommandListImp {
                                                      const ze_group_count_t &threadGroupDimensions,
                                                      Event *event,
                                                      CmdListKernelLaunchParams &launchParams);
+    ze_result_t appendLaunchKernelBatchEntry(const zex_kernel_launch_desc_t &launch, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
+                                             StackVec<Kernel *, 16> &batchResidentKernels, bool relaxedOrderingDispatch);
     MOCKABLE_VIRTUAL ze_result_t appendLaunchKernelSplit(Kernel *kernel,
                                                          const ze_group_count_t &threadGroupDimensions,
                                                          Event *event,
@@ -378,6 +386,21 @@ struct CommandListCoreFamily : public CommandListImp {
     bool singleEventPacketRequired(bool inputSinglePacketEventRequest) const;
     void programEventL3Flush(Event *event);
 
+    bool consumeMutableCommandPending();
+    bool isMutableWalkerPatchingSupported() const;
+    void recordMutableKernelDispatch(Kernel *kernel, Event *event, const ze_group_count_t &threadGroupDimensions, const CmdListKernelLaunchParams &launchParams,
+                                     CommandToPatchContainer &waitCommands, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    bool isMutableSignalEventPatchable(Event *event);
+    MutableKernelDispatch *getMutableKernelDispatch(uint64_t commandId);
+    ze_result_t updateMutableKernelArgument(MutableKernelDispatch &dispatch, const ze_mutable_kernel_argument_exp_desc_t &argDesc);
+    ze_result_t updateMutableGroupCount(MutableKernelDispatch &dispatch, const ze_group_count_t &groupCount);
+    ze_result_t updateMutableGlobalOffset(MutableKernelDispatch &dispatch, const ze_mutable_global_offset_exp_desc_t &offsetDesc);
+    void writeMutableCrossThreadData(MutableKernelDispatch &dispatch);
+    uint32_t getMutableInlineDataSize(Kernel &kernel) const;
+    void *getMutableInlineData(MutableKernelDispatch &dispatch) const;
+    ze_result_t patchMutableWalkerGroupCount(MutableKernelDispatch &dispatch);
+    ze_result_t patchMutableWalkerSignalEvent(MutableKernelDispatch &dispatch, uint64_t eventAddress);
+
     NEO::InOrderPatchCommandsContainer<GfxFamily> inOrderPatchCmds;
 
     bool latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
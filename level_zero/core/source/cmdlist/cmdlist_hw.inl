@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -107,11 +107,17 @@ void CommandListCoreFamily<gfxCoreFamily>::postInitComputeSetup() {
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
+    for (auto segment : this->recordingSegments) {
+        segment->reset();
+    }
     removeDeallocationContainerData();
     removeHostPtrAllocations();
     removeMemoryPrefetchAllocations();
     commandContainer.reset();
     clearCommandsToPatch();
+    mutableKernelDispatches.clear();
+    mutableCommandPending = false;
+    mutableCommandsClosed = false;
 
     if (!isCopyOnly(false)) {
         printfKernelContainer.clear();
@@ -207,7 +213,7 @@ void CommandListCoreFamily<gfxCoreFamily>::handleInOrderDependencyCounter(Event
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::handlePostSubmissionState() {
-    this->commandContainer.getResidencyContainer().clear();
+    this->commandContainer.clearResidencyContainer();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -362,12 +368,21 @@ inline ze_result_t CommandListCoreFamily<gfxCoreFamily>::executeCommandListImmed
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
     commandContainer.removeDuplicatesFromResidencyContainer();
+    mutableCommandPending = false;
+    mutableCommandsClosed = true;
     if (this->dispatchCmdListBatchBufferAsPrimary) {
         commandContainer.endAlignedPrimaryBuffer();
     } else {
         NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferEnd(commandContainer);
     }
 
+    for (auto segment : this->recordingSegments) {
+        auto ret = segment->close();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
     return ZE_RESULT_SUCCESS;
 }
 
@@ -382,6 +397,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
                                                                      ze_event_handle_t *phWaitEvents,
                                                                      CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
 
+    const bool recordMutableCommand = consumeMutableCommandPending() && !launchParams.isBuiltInKernel && !launchParams.isKernelSplitOperation;
+    if (recordMutableCommand && launchParams.isIndirect) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
     NEO::Device *neoDevice = device->getNEODevice();
     uint32_t callId = 0;
     if (NEO::debugManager.flags.EnableSWTags.get()) {
@@ -393,7 +413,13 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
         callId = neoDevice->getRootDeviceEnvironment().tagsManager->currentCallCount;
     }
 
-    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, launchParams.outListCommands, relaxedOrderingDispatch, true, true, launchParams.omitAddingWaitEventsResidency, false);
+    CommandToPatchContainer mutableWaitCommands;
+    auto outWaitCommands = launchParams.outListCommands;
+    if (recordMutableCommand && outWaitCommands == nullptr) {
+        outWaitCommands = &mutableWaitCommands;
+    }
+
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, outWaitCommands, relaxedOrderingDispatch, true, true, launchParams.omitAddingWaitEventsResidency, false);
     if (ret) {
         return ret;
     }
@@ -419,6 +445,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
     auto res = appendLaunchKernelWithParams(Kernel::fromHandle(kernelHandle), threadGroupDimensions,
                                             event, launchParams);
 
+    if (res == ZE_RESULT_SUCCESS && recordMutableCommand) {
+        recordMutableKernelDispatch(Kernel::fromHandle(kernelHandle), event, threadGroupDimensions, launchParams,
+                                    mutableWaitCommands, numWaitEvents, phWaitEvents);
+    }
+
     if (!launchParams.skipInOrderNonWalkerSignaling) {
         handleInOrderDependencyCounter(event, isInOrderNonWalkerSignalingRequired(event), false);
     }
@@ -535,6 +566,51 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
     return ret;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelBatch(uint32_t numLaunches, const zex_kernel_launch_desc_t *pLaunches, bool relaxedOrderingDispatch) {
+    StackVec<Kernel *, 16> batchResidentKernels;
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        auto ret = appendLaunchKernelBatchEntry(pLaunches[i], pLaunches[i].numWaitEvents, pLaunches[i].phWaitEvents, batchResidentKernels, relaxedOrderingDispatch);
+        if (ret) {
+            return ret;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelBatchEntry(const zex_kernel_launch_desc_t &launch, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
+                                                                              StackVec<Kernel *, 16> &batchResidentKernels, bool relaxedOrderingDispatch) {
+    auto hKernel = toInternalType(launch.hKernel);
+    if (hKernel == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    auto kernel = Kernel::fromHandle(hKernel);
+
+    for (uint32_t i = 0; i < launch.numArgs; i++) {
+        auto &arg = launch.pArgs[i];
+        auto ret = kernel->setArgumentValue(arg.argIndex, arg.argSize, arg.pArgValue);
+        if (ret) {
+            return ret;
+        }
+    }
+
+    // ISA and internal allocations of a kernel already launched in this batch are in the residency container;
+    // its argument allocations are as well, unless the launch changed them
+    bool kernelResident = std::find(batchResidentKernels.begin(), batchResidentKernels.end(), kernel) != batchResidentKernels.end();
+
+    CmdListKernelLaunchParams launchParams = {};
+    launchParams.omitAddingKernelInternalResidency = kernelResident;
+    launchParams.omitAddingKernelArgumentResidency = kernelResident && (launch.numArgs == 0);
+
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(hKernel, launch.groupCount, toInternalType(launch.hSignalEvent),
+                                                                        numWaitEvents, phWaitEvents, launchParams, relaxedOrderingDispatch);
+    if (ret == ZE_RESULT_SUCCESS && !kernelResident) {
+        batchResidentKernels.push_back(kernel);
+    }
+    return ret;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
     auto event = Event::fromHandle(hEvent);
@@ -1592,14 +1668,17 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(void *dstptr,
 
         if (ret == ZE_RESULT_SUCCESS && middleSizeBytes) {
 
-            Builtin copyKernel = BuiltinTypeHelper::adjustBuiltinType<Builtin::copyBufferToBufferMiddle>(isStateless, isHeapless);
+            // middle region is a multiple of cache line size, so it can always be split into 32 byte elements
+            const bool useWideMiddle = NEO::isWideCopyKernelPreferred(middleSizeBytes);
+            Builtin copyKernel = useWideMiddle ? BuiltinTypeHelper::adjustBuiltinType<Builtin::copyBufferToBufferMiddleWide>(isStateless, isHeapless)
+                                               : BuiltinTypeHelper::adjustBuiltinType<Builtin::copyBufferToBufferMiddle>(isStateless, isHeapless);
 
             ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAllocationStruct.alignedAllocationPtr),
                                                dstAllocationStruct.alloc, leftSize + dstAllocationStruct.offset,
                                                reinterpret_cast<void *>(&srcAllocationStruct.alignedAllocationPtr),
                                                srcAllocationStruct.alloc, leftSize + srcAllocationStruct.offset,
                                                middleSizeBytes,
-                                               middleElSize,
+                                               useWideMiddle ? middleElSize * 2 : middleElSize,
                                                copyKernel,
                                                signalEvent,
                                                isStateless,
@@ -4245,4 +4324,309 @@ void CommandListCoreFamily<gfxCoreFamily>::programEventL3Flush(Event *event) {
         args);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint64_t *pCommandId) {
+    if (!this->mutableCommandsEnabled || this->isImmediateType() || this->heaplessModeEnabled || !isMutableWalkerPatchingSupported()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (this->mutableCommandsClosed) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+
+    // group size changes require re-encoding local ids and thread dispatch parameters, which are not tracked
+    auto supportedFlags = L0GfxCoreHelper::getCmdListUpdateCapabilities(device->getNEODevice()->getRootDeviceEnvironment()) &
+                          ~static_cast<ze_mutable_command_exp_flags_t>(ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE);
+    if ((desc->flags & ~supportedFlags) != 0) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    // the id is reserved up front, it stays unbound when the next append is not a kernel launch
+    this->mutableKernelDispatches.emplace_back().flags = desc->flags;
+    this->mutableCommandPending = true;
+    auto commandStream = commandContainer.getCommandStream();
+    this->mutableCommandStreamPosition = ptrOffset(commandStream->getCpuBase(), commandStream->getUsed());
+    *pCommandId = static_cast<uint64_t>(this->mutableKernelDispatches.size());
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::consumeMutableCommandPending() {
+    if (!this->mutableCommandPending) {
+        return false;
+    }
+    this->mutableCommandPending = false;
+    // any command programmed since the id was handed out belongs to a different append
+    auto commandStream = commandContainer.getCommandStream();
+    return ptrOffset(commandStream->getCpuBase(), commandStream->getUsed()) == this->mutableCommandStreamPosition;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::recordMutableKernelDispatch(Kernel *kernel, Event *event, const ze_group_count_t &threadGroupDimensions, const CmdListKernelLaunchParams &launchParams,
+                                                                       CommandToPatchContainer &waitCommands, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    UNRECOVERABLE_IF(launchParams.outWalker == nullptr);
+
+    auto &dispatch = this->mutableKernelDispatches.back();
+    dispatch.kernel = kernel;
+    dispatch.walker = launchParams.outWalker;
+    dispatch.indirectData = launchParams.outIndirectData;
+    dispatch.groupCount = threadGroupDimensions;
+    std::copy_n(kernel->getGroupSize(), 3, dispatch.groupSize);
+    dispatch.inlineDataSize = getMutableInlineDataSize(*kernel);
+    dispatch.crossThreadData.assign(kernel->getCrossThreadData(), kernel->getCrossThreadData() + kernel->getCrossThreadDataSize());
+    dispatch.signalEvent = event;
+    dispatch.signalEventPatchable = isMutableSignalEventPatchable(event);
+
+    size_t semaphoresToPatch = 0;
+    dispatch.waitEventsPatchable = true;
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto waitEvent = Event::fromHandle(phWaitEvents[i]);
+        dispatch.waitEventsPatchable &= !waitEvent->isCounterBased();
+        dispatch.waitEventPackets.push_back(waitEvent->getPacketsToWait());
+        semaphoresToPatch += waitEvent->getPacketsToWait();
+    }
+    dispatch.waitEventsPatchable &= (semaphoresToPatch == waitCommands.size());
+    for (const auto &waitCommand : waitCommands) {
+        dispatch.waitEventsPatchable &= (waitCommand.type == CommandToPatch::WaitEventSemaphoreWait);
+    }
+    if (dispatch.waitEventsPatchable) {
+        dispatch.waitCommands = std::move(waitCommands);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isMutableSignalEventPatchable(Event *event) {
+    if (event == nullptr || this->isInOrderExecutionEnabled() || this->partitionCount > 1) {
+        return false;
+    }
+    if (event->isCounterBased() || event->isInterruptModeEnabled() || event->getAllocation(this->device) == nullptr) {
+        return false;
+    }
+    // only the walker post sync may signal the event, L3 flush and remaining packets are programmed with separate commands
+    if (getDcFlushRequired(event->isSignalScope())) {
+        return false;
+    }
+    return !(this->signalAllEventPackets && event->getMaxPacketsCount() > 1);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+MutableKernelDispatch *CommandListCoreFamily<gfxCoreFamily>::getMutableKernelDispatch(uint64_t commandId) {
+    if (commandId == 0 || commandId > this->mutableKernelDispatches.size() || this->mutableKernelDispatches[commandId - 1].kernel == nullptr) {
+        return nullptr;
+    }
+    return &this->mutableKernelDispatches[commandId - 1];
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::writeMutableCrossThreadData(MutableKernelDispatch &dispatch) {
+    auto inlineDataSize = std::min(static_cast<size_t>(dispatch.inlineDataSize), dispatch.crossThreadData.size());
+    if (inlineDataSize > 0) {
+        memcpy_s(getMutableInlineData(dispatch), inlineDataSize, dispatch.crossThreadData.data(), inlineDataSize);
+    }
+    auto indirectDataSize = dispatch.crossThreadData.size() - inlineDataSize;
+    if (indirectDataSize > 0 && dispatch.indirectData != nullptr) {
+        memcpy_s(dispatch.indirectData, indirectDataSize, ptrOffset(dispatch.crossThreadData.data(), inlineDataSize), indirectDataSize);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableKernelArgument(MutableKernelDispatch &dispatch, const ze_mutable_kernel_argument_exp_desc_t &argDesc) {
+    const auto &explicitArgs = dispatch.kernel->getKernelDescriptor().payloadMappings.explicitArgs;
+    if (argDesc.argIndex >= explicitArgs.size()) {
+        return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+    }
+
+    const auto &arg = explicitArgs[argDesc.argIndex];
+    auto crossThreadData = ArrayRef<uint8_t>(dispatch.crossThreadData.data(), dispatch.crossThreadData.size());
+
+    if (arg.is<NEO::ArgDescriptor::argTValue>()) {
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            if (element.sourceOffset >= argDesc.argSize || element.offset + element.size > crossThreadData.size()) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            size_t bytesToCopy = std::min(static_cast<size_t>(element.size), argDesc.argSize - element.sourceOffset);
+            auto pDst = ptrOffset(crossThreadData.begin(), element.offset);
+            if (argDesc.pArgValue) {
+                memcpy_s(pDst, element.size, ptrOffset(argDesc.pArgValue, element.sourceOffset), bytesToCopy);
+            } else {
+                memset(pDst, 0, bytesToCopy);
+            }
+        }
+    } else if (arg.is<NEO::ArgDescriptor::argTPointer>()) {
+        const auto &argAsPtr = arg.as<NEO::ArgDescPointer>();
+        // stateful access and slm arguments keep their surface state and slm layout from append time
+        if (arg.getTraits().getAddressQualifier() == NEO::KernelArgMetadata::AddrLocal ||
+            NEO::isValidOffset(argAsPtr.bindful) || NEO::isValidOffset(argAsPtr.bindless) ||
+            NEO::isUndefinedOffset(argAsPtr.stateless)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+
+        uintptr_t gpuAddress = 0u;
+        NEO::GraphicsAllocation *allocation = nullptr;
+        void *requestedAddress = argDesc.pArgValue ? *reinterpret_cast<void *const *>(argDesc.pArgValue) : nullptr;
+        if (requestedAddress != nullptr) {
+            allocation = device->getDriverHandle()->getDriverSystemMemoryAllocation(requestedAddress, 1u, device->getRootDeviceIndex(), &gpuAddress);
+            if (allocation == nullptr) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            commandContainer.addToResidencyContainer(allocation);
+        }
+        NEO::patchPointer(crossThreadData, argAsPtr, gpuAddress);
+    } else {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    writeMutableCrossThreadData(dispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableGroupCount(MutableKernelDispatch &dispatch, const ze_group_count_t &groupCount) {
+    if (groupCount.groupCountX == 0 || groupCount.groupCountY == 0 || groupCount.groupCountZ == 0) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    // implicit args and walker partitioning depend on the group count beyond the cross-thread data
+    if (dispatch.kernel->getImplicitArgs() != nullptr || this->partitionCount > 1) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    const auto &dispatchTraits = dispatch.kernel->getKernelDescriptor().payloadMappings.dispatchTraits;
+    auto crossThreadData = ArrayRef<uint8_t>(dispatch.crossThreadData.data(), dispatch.crossThreadData.size());
+    uint32_t numWorkGroups[3] = {groupCount.groupCountX, groupCount.groupCountY, groupCount.groupCountZ};
+    uint32_t globalWorkSize[3] = {numWorkGroups[0] * dispatch.groupSize[0], numWorkGroups[1] * dispatch.groupSize[1], numWorkGroups[2] * dispatch.groupSize[2]};
+    NEO::patchVecNonPointer(crossThreadData, dispatchTraits.numWorkGroups, numWorkGroups);
+    NEO::patchVecNonPointer(crossThreadData, dispatchTraits.globalWorkSize, globalWorkSize);
+
+    uint32_t workDim = 1;
+    if (globalWorkSize[2] > 1) {
+        workDim = 3;
+    } else if (globalWorkSize[1] > 1) {
+        workDim = 2;
+    }
+    NEO::patchNonPointer<uint32_t, uint32_t>(crossThreadData, dispatchTraits.workDim, workDim);
+
+    dispatch.groupCount = groupCount;
+    auto ret = patchMutableWalkerGroupCount(dispatch);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+    writeMutableCrossThreadData(dispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableGlobalOffset(MutableKernelDispatch &dispatch, const ze_mutable_global_offset_exp_desc_t &offsetDesc) {
+    if (dispatch.kernel->getImplicitArgs() != nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    const auto &dispatchTraits = dispatch.kernel->getKernelDescriptor().payloadMappings.dispatchTraits;
+    uint32_t globalOffsets[3] = {offsetDesc.offsetX, offsetDesc.offsetY, offsetDesc.offsetZ};
+    NEO::patchVecNonPointer(ArrayRef<uint8_t>(dispatch.crossThreadData.data(), dispatch.crossThreadData.size()), dispatchTraits.globalWorkOffset, globalOffsets);
+    writeMutableCrossThreadData(dispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) {
+    if (!this->mutableCommandsEnabled) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto getDispatch = [this](uint64_t commandId, ze_mutable_command_exp_flags_t requiredFlag) -> MutableKernelDispatch * {
+        auto dispatch = this->getMutableKernelDispatch(commandId);
+        if (dispatch == nullptr || (dispatch->flags & requiredFlag) == 0) {
+            return nullptr;
+        }
+        return dispatch;
+    };
+
+    auto extendedDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (extendedDesc) {
+        ze_result_t ret = ZE_RESULT_SUCCESS;
+        if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC) {
+            auto argDesc = reinterpret_cast<const ze_mutable_kernel_argument_exp_desc_t *>(extendedDesc);
+            auto dispatch = getDispatch(argDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS);
+            ret = dispatch ? updateMutableKernelArgument(*dispatch, *argDesc) : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC) {
+            auto groupCountDesc = reinterpret_cast<const ze_mutable_group_count_exp_desc_t *>(extendedDesc);
+            auto dispatch = getDispatch(groupCountDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT);
+            ret = (dispatch && groupCountDesc->pGroupCount) ? updateMutableGroupCount(*dispatch, *groupCountDesc->pGroupCount) : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC) {
+            auto offsetDesc = reinterpret_cast<const ze_mutable_global_offset_exp_desc_t *>(extendedDesc);
+            auto dispatch = getDispatch(offsetDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET);
+            ret = dispatch ? updateMutableGlobalOffset(*dispatch, *offsetDesc) : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GROUP_SIZE_EXP_DESC) {
+            ret = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        } else {
+            ret = ZE_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+        }
+
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+        extendedDesc = reinterpret_cast<const ze_base_desc_t *>(extendedDesc->pNext);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+    auto dispatch = getMutableKernelDispatch(commandId);
+    if (dispatch == nullptr || (dispatch->flags & ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT) == 0) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto event = Event::fromHandle(hSignalEvent);
+    if (!dispatch->signalEventPatchable || !isMutableSignalEventPatchable(event) ||
+        event->isUsingContextEndOffset() != dispatch->signalEvent->isUsingContextEndOffset()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto ret = patchMutableWalkerSignalEvent(*dispatch, event->getPacketAddress(this->device));
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    commandContainer.addToResidencyContainer(event->getAllocation(this->device));
+    event->resetKernelCountAndPacketUsedCount();
+    event->setPacketsInUse(this->partitionCount);
+    addToMappedEventList(event);
+    dispatch->signalEvent = event;
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
+
+    auto dispatch = getMutableKernelDispatch(commandId);
+    if (dispatch == nullptr || (dispatch->flags & ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS) == 0 ||
+        numWaitEvents != dispatch->waitEventPackets.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (!dispatch->waitEventsPatchable) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto event = Event::fromHandle(phWaitEvents[i]);
+        if (event->isCounterBased() || event->getPacketsToWait() != dispatch->waitEventPackets[i]) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+    }
+
+    size_t commandIndex = 0;
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto event = Event::fromHandle(phWaitEvents[i]);
+        uint64_t gpuAddress = event->getCompletionFieldGpuAddress(this->device);
+        for (uint32_t packet = 0; packet < dispatch->waitEventPackets[i]; packet++) {
+            auto semaphore = reinterpret_cast<MI_SEMAPHORE_WAIT *>(dispatch->waitCommands[commandIndex++].pDestination);
+            semaphore->setSemaphoreGraphicsAddress(gpuAddress);
+            gpuAddress += event->getSinglePacketSize();
+        }
+        commandContainer.addToResidencyContainer(event->getAllocation(this->device));
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -68,6 +68,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                            ze_event_handle_t hEvent, uint32_t numWaitEvents,
                                            ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
 
+    ze_result_t appendLaunchKernelBatch(uint32_t numLaunches, const zex_kernel_launch_desc_t *pLaunches, bool relaxedOrderingDispatch) override;
+
     ze_result_t appendBarrier(ze_event_handle_t hSignalEvent,
                               uint32_t numWaitEvents,
                               ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
@@ -173,6 +175,37 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     ze_result_t appendWriteToMemory(void *desc, void *ptr,
                                     uint64_t data) override;
 
+    ze_result_t appendLaunchMultipleKernelsIndirect(uint32_t numKernels,
+                                                    const ze_kernel_handle_t *kernelHandles,
+                                                    const uint32_t *pNumLaunchArguments,
+                                                    const ze_group_count_t *pLaunchArgumentsBuffer,
+                                                    ze_event_handle_t hEvent,
+                                                    uint32_t numWaitEvents,
+                                                    ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
+    ze_result_t appendMemAdvise(ze_device_handle_t hDevice,
+                                const void *ptr, size_t size,
+                                ze_memory_advice_t advice) override;
+    ze_result_t appendMemoryPrefetch(const void *ptr, size_t count) override;
+    ze_result_t appendQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
+                                            const size_t *pOffsets, ze_event_handle_t hSignalEvent,
+                                            uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+    ze_result_t appendMetricMemoryBarrier() override;
+    ze_result_t appendMetricStreamerMarker(zet_metric_streamer_handle_t hMetricStreamer,
+                                           uint32_t value) override;
+    ze_result_t appendMetricQueryBegin(zet_metric_query_handle_t hMetricQuery) override;
+    ze_result_t appendMetricQueryEnd(zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent,
+                                     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+    ze_result_t appendMILoadRegImm(uint32_t reg, uint32_t value, bool isBcs) override;
+    ze_result_t appendMILoadRegReg(uint32_t reg1, uint32_t reg2) override;
+    ze_result_t appendMILoadRegMem(uint32_t reg1, uint64_t address) override;
+    ze_result_t appendMIStoreRegMem(uint32_t reg1, uint64_t address) override;
+    ze_result_t appendMIMath(void *aluArray, size_t aluCount) override;
+    ze_result_t appendMIBBStart(uint64_t address, size_t predication, bool secondLevel) override;
+    ze_result_t appendMIBBEnd() override;
+    ze_result_t appendMINoop() override;
+    ze_result_t appendPipeControl(void *dstPtr, uint64_t value) override;
+    ze_result_t appendSoftwareTag(const char *data) override;
+
     ze_result_t hostSynchronize(uint64_t timeout) override;
 
     ze_result_t close() override {
@@ -184,6 +217,9 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     ze_result_t appendCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists,
                                    ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
 
+    ze_result_t beginGraphCapture() override;
+    ze_result_t endGraphCapture(ze_command_list_handle_t *phGraph) override;
+
     NEO::CompletionStamp flushRegularTask(NEO::LinearStream &cmdStreamTask, size_t taskStartOffset, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool requireTaskCountUpdate);
     NEO::CompletionStamp flushImmediateRegularTask(NEO::LinearStream &cmdStreamTask, size_t taskStartOffset, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool requireTaskCountUpdate);
     NEO::CompletionStamp flushImmediateRegularTaskStateless(NEO::LinearStream &cmdStreamTask, size_t taskStartOffset, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool requireTaskCountUpdate);
@@ -194,6 +230,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void handleDebugSurfaceStateUpdate(NEO::IndirectHeap *ssh);
 
     void checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize);
+    ze_result_t flushLaunchKernelBatch(ze_result_t inputRet, const zex_kernel_launch_desc_t *pLaunches, uint32_t numLaunches, bool hasStallingCmds, bool hasRelaxedOrderingDependencies);
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     MOCKABLE_VIRTUAL ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate);
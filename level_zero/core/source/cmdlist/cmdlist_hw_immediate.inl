@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
@@ -407,6 +408,10 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
     auto commandStream = this->commandContainer.getCommandStream();
     size_t commandStreamStart = this->cmdListCurrentStartOffset;
 
+    // commands and in-order counters were encoded into the list's own stream at append time,
+    // only the submission itself has to be serialized on the CSR
+    static_cast<CommandQueueHw<gfxCoreFamily> *>(this->cmdQImmediate)->patchCommands(*this, 0u, false);
+
     auto csr = static_cast<CommandQueueImp *>(cmdQ)->getCsr();
     auto lockCSR = csr->obtainUniqueOwnership();
 
@@ -430,9 +435,7 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
         }
     }
 
-    cmdQ->makeResidentAndMigrate(performMigration, this->commandContainer.getResidencyContainer());
-
-    static_cast<CommandQueueHw<gfxCoreFamily> *>(this->cmdQImmediate)->patchCommands(*this, 0u, false);
+    cmdQ->makeResidentAndMigrate(performMigration, this->commandContainer.peekResidencyContainer());
 
     if (performMigration) {
         this->migrateSharedAllocations();
@@ -444,6 +447,8 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
                                                  *this->device->getDriverHandle()->getSvmAllocsManager(),
                                                  *this->device->getNEODevice(),
                                                  *csr);
+        // launches flushed here are not submitted again, only their history is kept
+        prefetchManager->removeKernelLaunches(this->getPrefetchContext());
     }
 
     NEO::CompletionStamp completionStamp;
@@ -464,6 +469,8 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
     auto cmdQImp = static_cast<CommandQueueImp *>(cmdQ);
     cmdQImp->clearHeapContainer();
 
+    lockCSR.unlock();
+
     this->cmdListCurrentStartOffset = commandStream->getUsed();
     this->containsAnyKernel = false;
     this->handlePostSubmissionState();
@@ -472,7 +479,6 @@ inline ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommand
         this->device->getNEODevice()->debugExecutionCounter++;
     }
 
-    lockCSR.unlock();
     ze_result_t status = ZE_RESULT_SUCCESS;
     if (cmdQ == this->cmdQImmediate || cmdQ == this->cmdQImmediateCopyOffload) {
         cmdQ->setTaskCount(completionStamp.taskCount);
@@ -509,6 +515,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &threadGroupDimensions,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendLaunchKernel(kernelHandle, threadGroupDimensions, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, relaxedOrderingDispatch);
+    }
 
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
@@ -540,6 +549,87 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     return flushImmediate(ret, true, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch, true, false, hSignalEvent, false);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelBatch(uint32_t numLaunches, const zex_kernel_launch_desc_t *pLaunches, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendLaunchKernelBatch(numLaunches, pLaunches, relaxedOrderingDispatch);
+    }
+
+    // relaxed ordering selects the command buffer placement, so it is decided once for the whole batch
+    uint32_t totalWaitEvents = 0;
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        totalWaitEvents += pLaunches[i].numWaitEvents;
+    }
+    relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(totalWaitEvents, false);
+    bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(totalWaitEvents, relaxedOrderingDispatch);
+    bool hostWait = waitForEventsFromHost();
+
+    StackVec<Kernel *, 16> batchResidentKernels;
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    uint32_t firstPendingLaunch = 0;
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        auto numWaitEvents = pLaunches[i].numWaitEvents;
+        auto phWaitEvents = pLaunches[i].phWaitEvents;
+
+        // launches appended so far are submitted together; submit them early only when the command buffer
+        // has to be switched or the next launch waits on the host for events they may signal
+        size_t requiredSpace = commonImmediateCommandSize + NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numWaitEvents;
+        bool submissionRequired = this->commandContainer.getCommandStream()->getAvailableSpace() < requiredSpace;
+        submissionRequired |= (hostWait && numWaitEvents > 0);
+        if (submissionRequired && i > firstPendingLaunch) {
+            ret = flushLaunchKernelBatch(ret, pLaunches + firstPendingLaunch, i - firstPendingLaunch, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch);
+            if (ret) {
+                return ret;
+            }
+            firstPendingLaunch = i;
+            batchResidentKernels.clear();
+        }
+
+        checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
+        if (hostWait && numWaitEvents > 0) {
+            this->synchronizeEventList(numWaitEvents, phWaitEvents);
+            numWaitEvents = 0u;
+            phWaitEvents = nullptr;
+        }
+
+        ret = this->appendLaunchKernelBatchEntry(pLaunches[i], numWaitEvents, phWaitEvents, batchResidentKernels, relaxedOrderingDispatch);
+        if (ret) {
+            // launches preceding the failing one already advanced the in-order counter and their events, so they are submitted;
+            // the failing launch and the rest of the batch are not
+            if (i > firstPendingLaunch) {
+                auto flushRet = flushLaunchKernelBatch(ZE_RESULT_SUCCESS, pLaunches + firstPendingLaunch, i - firstPendingLaunch, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch);
+                if (flushRet) {
+                    return flushRet;
+                }
+            }
+            return ret;
+        }
+    }
+
+    return flushLaunchKernelBatch(ret, pLaunches + firstPendingLaunch, numLaunches - firstPendingLaunch, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushLaunchKernelBatch(ze_result_t inputRet, const zex_kernel_launch_desc_t *pLaunches, uint32_t numLaunches,
+                                                                                  bool hasStallingCmds, bool hasRelaxedOrderingDependencies) {
+    ze_event_handle_t hLastSignalEvent = nullptr;
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        if (pLaunches[i].hSignalEvent) {
+            hLastSignalEvent = toInternalType(pLaunches[i].hSignalEvent);
+        }
+    }
+
+    auto ret = flushImmediate(inputRet, true, hasStallingCmds, hasRelaxedOrderingDependencies, true, false, hLastSignalEvent, false);
+
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        auto hSignalEvent = toInternalType(pLaunches[i].hSignalEvent);
+        if (hSignalEvent && hSignalEvent != hLastSignalEvent) {
+            Event::fromHandle(hSignalEvent)->setCsr(this->getCsr(false), isInOrderExecutionEnabled());
+        }
+    }
+    return ret;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result) {
     bool nonWalkerSignalingHasRelaxedOrdering = false;
@@ -563,6 +653,10 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &pDispatchArgumentsBuffer,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendLaunchKernelIndirect(kernelHandle, pDispatchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -575,6 +669,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     bool isStallingOperation = true;
@@ -608,6 +706,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch, forceDisableCopyOnlyInOrderSignaling);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, isCopyOffloadEnabled());
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -662,6 +764,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch, srcPtr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch, forceDisableCopyOnlyInOrderSignaling);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, isCopyOffloadEnabled());
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -712,6 +818,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -723,6 +833,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hSignalEvent) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendSignalEvent(hSignalEvent);
+    }
+
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -733,6 +847,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hSignalEvent) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendEventReset(hSignalEvent);
+    }
+
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -774,6 +892,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phWaitEvents, CommandToPatchContainer *outWaitCmds,
                                                                               bool relaxedOrderingAllowed, bool trackDependencies, bool apiRequest, bool skipAddingWaitEventsToResidency, bool skipFlush, bool copyOffloadOperation) {
+    if (this->graphCaptureTarget && apiRequest) {
+        return this->graphCaptureTarget->appendWaitOnEvents(numEvents, phWaitEvents, outWaitCmds, relaxedOrderingAllowed, trackDependencies, apiRequest, skipAddingWaitEventsToResidency, skipFlush, copyOffloadOperation);
+    }
+
     bool allSignaled = true;
     for (auto i = 0u; i < numEvents; i++) {
         allSignaled &= (!this->dcFlushSupport && Event::fromHandle(phWaitEvents[i])->isAlreadyCompleted());
@@ -800,6 +922,9 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
 
@@ -835,6 +960,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
                                                                                  ze_event_handle_t hSignalEvent,
                                                                                  uint32_t numWaitEvents,
                                                                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -860,6 +989,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -878,6 +1011,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -898,6 +1035,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendImageCopyFromMemoryExt(hDstImage, srcPtr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -918,6 +1059,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendImageCopyToMemoryExt(dstPtr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -935,6 +1080,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      ze_event_handle_t hSignalEvent,
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
 
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
@@ -943,6 +1092,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(void *desc, void *ptr, uint64_t data, ze_event_handle_t signalEventHandle, bool useQwordData) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendWaitOnMemory(desc, ptr, data, signalEventHandle, useQwordData);
+    }
+
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(desc, ptr, data, signalEventHandle, useQwordData);
     return flushImmediate(ret, true, false, false, false, false, signalEventHandle, false);
@@ -950,11 +1103,168 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(vo
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(void *desc, void *ptr, uint64_t data) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendWriteToMemory(desc, ptr, data);
+    }
+
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(desc, ptr, data);
     return flushImmediate(ret, true, false, false, false, false, nullptr, false);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchMultipleKernelsIndirect(uint32_t numKernels,
+                                                                                               const ze_kernel_handle_t *kernelHandles,
+                                                                                               const uint32_t *pNumLaunchArguments,
+                                                                                               const ze_group_count_t *pLaunchArgumentsBuffer,
+                                                                                               ze_event_handle_t hSignalEvent,
+                                                                                               uint32_t numWaitEvents,
+                                                                                               ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pNumLaunchArguments, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pNumLaunchArguments, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemAdvise(ze_device_handle_t hDevice, const void *ptr, size_t size, ze_memory_advice_t advice) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemAdvise(hDevice, ptr, size, advice);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMemAdvise(hDevice, ptr, size, advice);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryPrefetch(const void *ptr, size_t count) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryPrefetch(ptr, count);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(ptr, count);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
+                                                                                       const size_t *pOffsets, ze_event_handle_t hSignalEvent,
+                                                                                       uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMetricMemoryBarrier() {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMetricMemoryBarrier();
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMetricMemoryBarrier();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMetricStreamerMarker(zet_metric_streamer_handle_t hMetricStreamer, uint32_t value) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMetricStreamerMarker(hMetricStreamer, value);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMetricStreamerMarker(hMetricStreamer, value);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMetricQueryBegin(zet_metric_query_handle_t hMetricQuery) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMetricQueryBegin(hMetricQuery);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMetricQueryBegin(hMetricQuery);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMetricQueryEnd(zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent,
+                                                                                uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMetricQueryEnd(hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMetricQueryEnd(hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMILoadRegImm(uint32_t reg, uint32_t value, bool isBcs) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMILoadRegImm(reg, value, isBcs);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMILoadRegImm(reg, value, isBcs);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMILoadRegReg(uint32_t reg1, uint32_t reg2) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMILoadRegReg(reg1, reg2);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMILoadRegReg(reg1, reg2);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMILoadRegMem(uint32_t reg1, uint64_t address) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMILoadRegMem(reg1, address);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMILoadRegMem(reg1, address);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMIStoreRegMem(uint32_t reg1, uint64_t address) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMIStoreRegMem(reg1, address);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMIStoreRegMem(reg1, address);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMIMath(void *aluArray, size_t aluCount) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMIMath(aluArray, aluCount);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMIMath(aluArray, aluCount);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMIBBStart(uint64_t address, size_t predication, bool secondLevel) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMIBBStart(address, predication, secondLevel);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMIBBStart(address, predication, secondLevel);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMIBBEnd() {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMIBBEnd();
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMIBBEnd();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMINoop() {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMINoop();
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMINoop();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPipeControl(void *dstPtr, uint64_t value) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendPipeControl(dstPtr, value);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendPipeControl(dstPtr, value);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSoftwareTag(const char *data) {
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendSoftwareTag(data);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendSoftwareTag(data);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout, bool handlePostWaitOperations) {
     ze_result_t status = ZE_RESULT_SUCCESS;
@@ -1040,6 +1350,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint6
             }
 
             this->printKernelsPrintfOutput(status == ZE_RESULT_ERROR_DEVICE_LOST);
+            this->device->getNEODevice()->getExecutionEnvironment()->drainPrintfOutput();
             this->checkAssert();
         }
     }
@@ -1508,6 +1819,9 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::allocateOrReuseKernelPrivate
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists,
                                                                               ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureTarget) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
 
     auto ret = ZE_RESULT_SUCCESS;
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
@@ -1519,6 +1833,18 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendCommandLists(ui
         return ret;
     }
 
+    // captured graphs carry their own in-order counter, so chain them into this list's in-order dependencies
+    bool graphReplay = false;
+    if (isInOrderExecutionEnabled()) {
+        for (uint32_t i = 0; i < numCommandLists; i++) {
+            graphReplay |= CommandList::fromHandle(phCommandLists[i])->isCapturedGraph();
+        }
+    }
+
+    if (graphReplay) {
+        CommandListCoreFamily<gfxCoreFamily>::handleInOrderImplicitDependencies(false, false);
+    }
+
     auto cmdQueue = this->cmdQImmediate;
     ret = cmdQueue->executeCommandLists(numCommandLists, phCommandLists, nullptr, true, this->commandContainer.getCommandStream());
     if (ret != ZE_RESULT_SUCCESS) {
@@ -1528,6 +1854,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendCommandLists(ui
     bool relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
     if (hSignalEvent) {
         ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEvent);
+    } else if (graphReplay) {
+        CommandListCoreFamily<gfxCoreFamily>::appendSignalInOrderDependencyCounter(nullptr, false);
+        CommandListCoreFamily<gfxCoreFamily>::handleInOrderDependencyCounter(nullptr, false, false);
     }
 
     if (ret != ZE_RESULT_SUCCESS) {
@@ -1537,4 +1866,43 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendCommandLists(ui
     return flushImmediate(ret, true, hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch), relaxedOrderingDispatch, true, false, hSignalEvent, true);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::beginGraphCapture() {
+    if (this->graphCaptureTarget) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    ze_command_list_flags_t captureFlags = isInOrderExecutionEnabled() ? static_cast<ze_command_list_flags_t>(ZE_COMMAND_LIST_FLAG_IN_ORDER) : 0u;
+    auto productFamily = this->device->getHwInfo().platform.eProductFamily;
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+
+    this->graphCaptureTarget = CommandList::create(productFamily, this->device, this->engineGroupType, captureFlags, returnValue, false);
+    if (!this->graphCaptureTarget) {
+        return returnValue;
+    }
+    this->graphCaptureTarget->setCmdListContext(this->getCmdListContext());
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::endGraphCapture(ze_command_list_handle_t *phGraph) {
+    if (!this->graphCaptureTarget) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto graph = this->graphCaptureTarget;
+    this->graphCaptureTarget = nullptr;
+
+    auto ret = graph->close();
+    if (ret != ZE_RESULT_SUCCESS) {
+        graph->destroy();
+        return ret;
+    }
+
+    graph->markAsCapturedGraph();
+    *phGraph = graph->toHandle();
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -203,6 +203,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         nullptr,                                                // cpuWalkerBuffer
         nullptr,                                                // cpuPayloadBuffer
         nullptr,                                                // outImplicitArgsPtr
+        nullptr,                                                // outIndirectDataPtr
         &additionalCommands,                                    // additionalCommands
         commandListPreemptionMode,                              // preemptionMode
         launchParams.requiredPartitionDim,                      // requiredPartitionDim
@@ -357,4 +358,29 @@ bool CommandListCoreFamily<gfxCoreFamily>::singleEventPacketRequired(bool inputS
     return true;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isMutableWalkerPatchingSupported() const {
+    return false;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+uint32_t CommandListCoreFamily<gfxCoreFamily>::getMutableInlineDataSize(Kernel &kernel) const {
+    return 0u;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void *CommandListCoreFamily<gfxCoreFamily>::getMutableInlineData(MutableKernelDispatch &dispatch) const {
+    return nullptr;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::patchMutableWalkerGroupCount(MutableKernelDispatch &dispatch) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::patchMutableWalkerSignalEvent(MutableKernelDispatch &dispatch, uint64_t eventAddress) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/kernel/grf_config.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/unified_memory/unified_memory.h"
@@ -325,6 +326,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         launchParams.cmdWalkerBuffer,                           // cpuWalkerBuffer
         launchParams.hostPayloadBuffer,                         // cpuPayloadBuffer
         nullptr,                                                // outImplicitArgsPtr
+        nullptr,                                                // outIndirectDataPtr
         &additionalCommands,                                    // additionalCommands
         kernelPreemptionMode,                                   // preemptionMode
         launchParams.requiredPartitionDim,                      // requiredPartitionDim
@@ -351,9 +353,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         !this->scratchAddressPatchingEnabled,                   // immediateScratchAddressPatching
         launchParams.makeKernelCommandView,                     // makeCommandView
     };
+    dispatchKernelArgs.requiresExclusiveIndirectData = this->isMutableCommandsEnabled();
 
     NEO::EncodeDispatchKernel<GfxFamily>::encodeCommon(commandContainer, dispatchKernelArgs);
     launchParams.outWalker = dispatchKernelArgs.outWalkerPtr;
+    launchParams.outIndirectData = dispatchKernelArgs.outIndirectDataPtr;
 
     if (this->heaplessModeEnabled && this->scratchAddressPatchingEnabled && kernelNeedsScratchSpace) {
         CommandToPatch scratchInlineData;
@@ -447,6 +451,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         }
     }
 
+    if (NEO::PrefetchManager::isAdaptivePrefetchEnabled() && !launchParams.isBuiltInKernel) {
+        auto prefetchManager = this->device->getDriverHandle()->getMemoryManager()->getPrefetchManager();
+        if (prefetchManager) {
+            prefetchManager->recordKernelLaunch(this->prefetchContext, kernelDescriptor, kernel->getArgumentsResidencyContainer(), *this->device->getDriverHandle()->getSvmAllocsManager());
+            this->performMemoryPrefetch = true;
+        }
+    }
+
     // Store PrintfBuffer from a kernel
     {
         if (kernelDescriptor.kernelAttributes.flags.usesPrintf) {
@@ -569,4 +581,42 @@ bool CommandListCoreFamily<gfxCoreFamily>::singleEventPacketRequired(bool inputS
     return inputSinglePacketEventRequest;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isMutableWalkerPatchingSupported() const {
+    return true;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+uint32_t CommandListCoreFamily<gfxCoreFamily>::getMutableInlineDataSize(Kernel &kernel) const {
+    using WalkerType = typename GfxFamily::DefaultWalkerType;
+    if (!NEO::EncodeDispatchKernel<GfxFamily>::inlineDataProgrammingRequired(kernel.getKernelDescriptor())) {
+        return 0u;
+    }
+    return std::min(WalkerType::getInlineDataSize(), kernel.getCrossThreadDataSize());
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void *CommandListCoreFamily<gfxCoreFamily>::getMutableInlineData(MutableKernelDispatch &dispatch) const {
+    using WalkerType = typename GfxFamily::DefaultWalkerType;
+    return reinterpret_cast<WalkerType *>(dispatch.walker)->getInlineDataPointer();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::patchMutableWalkerGroupCount(MutableKernelDispatch &dispatch) {
+    using WalkerType = typename GfxFamily::DefaultWalkerType;
+    auto walker = reinterpret_cast<WalkerType *>(dispatch.walker);
+    walker->setThreadGroupIdXDimension(dispatch.groupCount.groupCountX);
+    walker->setThreadGroupIdYDimension(dispatch.groupCount.groupCountY);
+    walker->setThreadGroupIdZDimension(dispatch.groupCount.groupCountZ);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::patchMutableWalkerSignalEvent(MutableKernelDispatch &dispatch, uint64_t eventAddress) {
+    using WalkerType = typename GfxFamily::DefaultWalkerType;
+    auto walker = reinterpret_cast<WalkerType *>(dispatch.walker);
+    walker->getPostSync().setDestinationAddress(eventAddress);
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
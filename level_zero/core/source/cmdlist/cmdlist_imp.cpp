@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,21 @@ CommandListAllocatorFn commandListFactory[IGFX_MAX_PRODUCT] = {};
 CommandListAllocatorFn commandListFactoryImmediate[IGFX_MAX_PRODUCT] = {};
 
 ze_result_t CommandListImp::destroy() {
+    if (this->recordingSegmentParent) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (auto segment : this->recordingSegments) {
+        static_cast<CommandListImp *>(segment)->recordingSegmentParent = nullptr;
+        segment->destroy();
+    }
+    this->recordingSegments.clear();
+
+    if (this->graphCaptureTarget) {
+        this->graphCaptureTarget->destroy();
+        this->graphCaptureTarget = nullptr;
+    }
+
     if (this->isBcsSplitNeeded) {
         static_cast<DeviceImp *>(this->device)->bcsSplit.releaseResources();
     }
@@ -129,6 +144,39 @@ CommandList *CommandList::create(uint32_t productFamily, Device *device, NEO::En
     return commandList;
 }
 
+ze_result_t CommandListImp::createRecordingSegments(uint32_t numSegments, ze_command_list_handle_t *phSegments) {
+    if (isImmediateType() || isRecordingSegment() || isInOrderExecutionEnabled() || isMutableCommandsEnabled()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (numSegments == 0 || !this->recordingSegments.empty()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto productFamily = this->device->getHwInfo().platform.eProductFamily;
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+
+    for (auto i = 0u; i < numSegments; i++) {
+        auto segment = static_cast<CommandListImp *>(CommandList::create(productFamily, this->device, this->engineGroupType, this->flags, returnValue, this->internalUsage));
+        if (!segment) {
+            for (auto createdSegment : this->recordingSegments) {
+                static_cast<CommandListImp *>(createdSegment)->recordingSegmentParent = nullptr;
+                createdSegment->destroy();
+            }
+            this->recordingSegments.clear();
+            return returnValue;
+        }
+        segment->setCmdListContext(this->getCmdListContext());
+        segment->ordinal = this->ordinal;
+        segment->recordingSegmentParent = this;
+        this->recordingSegments.push_back(segment);
+    }
+
+    for (auto i = 0u; i < numSegments; i++) {
+        phSegments[i] = this->recordingSegments[i]->toHandle();
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t CommandListImp::getDeviceHandle(ze_device_handle_t *phDevice) {
     *phDevice = getDevice()->toHandle();
     return ZE_RESULT_SUCCESS;
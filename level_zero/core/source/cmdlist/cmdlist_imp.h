@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@ struct CommandListImp : public CommandList {
     using CommandList::CommandList;
 
     ze_result_t destroy() override;
+    ze_result_t createRecordingSegments(uint32_t numSegments, ze_command_list_handle_t *phSegments) override;
 
     ze_result_t appendMetricMemoryBarrier() override;
     ze_result_t appendMetricStreamerMarker(zet_metric_streamer_handle_t hMetricStreamer,
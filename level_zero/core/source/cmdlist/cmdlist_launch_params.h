@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,6 +47,7 @@ using CommandToPatchContainer = std::vector<CommandToPatch>;
 
 struct CmdListKernelLaunchParams {
     void *outWalker = nullptr;
+    void *outIndirectData = nullptr;
     void *cmdWalkerBuffer = nullptr;
     void *hostPayloadBuffer = nullptr;
     CommandToPatch *outSyncCommand = nullptr;
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "level_zero/core/source/cmdlist/cmdlist_launch_params.h"
+#include <level_zero/ze_api.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace L0 {
+struct Event;
+struct Kernel;
+
+// Patch locations of a kernel dispatch recorded in a mutable command list.
+// The cross-thread data is a private copy of the payload programmed at append time;
+// updates are applied to the copy and written back to the walker inline data and indirect heap.
+struct MutableKernelDispatch {
+    std::vector<uint8_t> crossThreadData;
+    std::vector<uint32_t> waitEventPackets;
+    CommandToPatchContainer waitCommands;
+    Kernel *kernel = nullptr;
+    Event *signalEvent = nullptr;
+    void *walker = nullptr;
+    void *indirectData = nullptr;
+    ze_group_count_t groupCount = {};
+    uint32_t groupSize[3] = {};
+    uint32_t inlineDataSize = 0;
+    ze_mutable_command_exp_flags_t flags = 0;
+    bool signalEventPatchable = false;
+    bool waitEventsPatchable = false;
+};
+
+using MutableKernelDispatches = std::vector<MutableKernelDispatch>;
+
+} // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "level_zero/core/source/cmdlist/cmdlist.h"
 #include <level_zero/ze_api.h>
 
 namespace L0 {
@@ -14,20 +15,20 @@ ze_result_t zeCommandListGetNextCommandIdExp(
     ze_command_list_handle_t hCommandList,
     const ze_mutable_command_id_exp_desc_t *desc,
     uint64_t *pCommandId) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    return L0::CommandList::fromHandle(hCommandList)->getNextCommandId(desc, pCommandId);
 }
 
 ze_result_t zeCommandListUpdateMutableCommandsExp(
     ze_command_list_handle_t hCommandList,
     const ze_mutable_commands_exp_desc_t *desc) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    return L0::CommandList::fromHandle(hCommandList)->updateMutableCommands(desc);
 }
 
 ze_result_t zeCommandListUpdateMutableCommandSignalEventExp(
     ze_command_list_handle_t hCommandList,
     uint64_t commandId,
     ze_event_handle_t hSignalEvent) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    return L0::CommandList::fromHandle(hCommandList)->updateMutableCommandSignalEvent(commandId, hSignalEvent);
 }
 
 ze_result_t zeCommandListUpdateMutableCommandWaitEventsExp(
@@ -35,7 +36,7 @@ ze_result_t zeCommandListUpdateMutableCommandWaitEventsExp(
     uint64_t commandId,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    return L0::CommandList::fromHandle(hCommandList)->updateMutableCommandWaitEvents(commandId, numWaitEvents, phWaitEvents);
 }
 } // namespace L0
 
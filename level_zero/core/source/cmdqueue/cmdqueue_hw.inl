@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <unordered_set>
 
 namespace L0 {
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -69,6 +70,12 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     auto ret = ZE_RESULT_SUCCESS;
 
+    std::vector<ze_command_list_handle_t> expandedCommandLists;
+    if (CommandList::expandRecordingSegments(numCommandLists, phCommandLists, expandedCommandLists)) {
+        numCommandLists = static_cast<uint32_t>(expandedCommandLists.size());
+        phCommandLists = expandedCommandLists.data();
+    }
+
     this->device->activateMetricGroups();
 
     if (NEO::debugManager.flags.DeferStateInitSubmissionToFirstRegularUsage.get() == 1) {
@@ -784,6 +791,8 @@ void CommandQueueHw<gfxCoreFamily>::setupCmdListsAndContextParams(
 
     ctx.containsAnyRegularCmdList = !ctx.firstCommandList->isImmediateType();
 
+    // residency of a command list submitted several times in one call is merged only once
+    std::unordered_set<CommandList *> residencyMergedCommandLists;
     for (auto i = 0u; i < numCommandLists; i++) {
         auto commandList = static_cast<CommandListImp *>(CommandList::fromHandle(phCommandLists[i]));
         commandList->storeReferenceTsToMappedEvents(false);
@@ -835,7 +844,9 @@ void CommandQueueHw<gfxCoreFamily>::setupCmdListsAndContextParams(
             commandList->registerCsrDcFlushForDcMitigation(*this->getCsr());
         }
 
-        makeResidentAndMigrate(ctx.isMigrationRequested, commandContainer.getResidencyContainer());
+        if (residencyMergedCommandLists.insert(commandList).second) {
+            makeResidentAndMigrate(ctx.isMigrationRequested, commandContainer.peekResidencyContainer());
+        }
     }
 
     if (parentImmediateCommandlistLinearStream) {
@@ -900,7 +911,7 @@ size_t CommandQueueHw<gfxCoreFamily>::estimateCommandListPrimaryStart(bool requi
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 size_t CommandQueueHw<gfxCoreFamily>::estimateCommandListResidencySize(CommandList *commandList) {
-    return commandList->getCmdContainer().getResidencyContainer().size();
+    return commandList->getCmdContainer().peekResidencyContainer().size();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -221,6 +221,7 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
     uint32_t index = 0;
     uint32_t commandQueueGroupOrdinal = desc->commandQueueGroupOrdinal;
     NEO::SynchronizedDispatchMode syncDispatchMode = NEO::SynchronizedDispatchMode::disabled;
+    bool mutableCommandList = false;
     adjustCommandQueueDesc(commandQueueGroupOrdinal, index);
 
     NEO::EngineGroupType engineGroupType = getEngineGroupTypeForOrdinal(commandQueueGroupOrdinal);
@@ -243,6 +244,10 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
             createCommandList = newCreateFunc;
         }
 
+        if (pNext->stype == ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_DESC) {
+            mutableCommandList = true;
+        }
+
         pNext = reinterpret_cast<const ze_base_desc_t *>(pNext->pNext);
     }
 
@@ -257,6 +262,10 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
 
     cmdList->setOrdinal(desc->commandQueueGroupOrdinal);
 
+    if (mutableCommandList) {
+        cmdList->enableMutableCommands();
+    }
+
     if (syncDispatchMode != NEO::SynchronizedDispatchMode::disabled) {
         if (cmdList->isInOrderExecutionEnabled()) {
             cmdList->enableSynchronizedDispatch(syncDispatchMode);
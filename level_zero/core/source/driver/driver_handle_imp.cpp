@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -189,6 +189,12 @@ DriverHandleImp::~DriverHandleImp() {
             this->svmAllocsManager->trimUSMDeviceAllocCache();
             this->usmHostMemAllocPool.cleanup();
         }
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintEventPoolAllocationCacheStatistics.get(), stdout,
+                           "Event pool allocation cache: %llu hits, %llu misses, hit rate %.2f\n",
+                           static_cast<unsigned long long>(this->eventPoolAllocationCache.getHitCount()),
+                           static_cast<unsigned long long>(this->eventPoolAllocationCache.getMissCount()),
+                           this->eventPoolAllocationCache.getHitRate());
+        this->eventPoolAllocationCache.trim(*memoryManager);
     }
 
     for (auto &device : this->devices) {
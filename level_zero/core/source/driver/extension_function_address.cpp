@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,10 @@ void *ExtensionFunctionAddressHelper::getExtensionFunctionAddress(const std::str
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWaitOnMemory);
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWaitOnMemory64);
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWriteToMemory);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendLaunchKernelBatch);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListBeginGraphCapture);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListEndGraphCapture);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListCreateRecordingSegments);
 
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventCreate);
     RETURN_FUNC_PTR_IF_EXIST(zexEventGetDeviceAddress);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,6 +115,28 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
     bool allocatedMemory = false;
 
     auto neoDevice = devices[0]->getNEODevice();
+    this->allocationCacheable = EventPoolAllocationCache::isEnabled() &&
+                                this->devices.size() == 1 &&
+                                !isIpcPoolFlagSet() &&
+                                !neoDevice->getDefaultEngine().commandStreamReceiver->isTbxMode();
+    if (this->allocationCacheable) {
+        this->allocationCacheKey.size = this->eventPoolSize;
+        this->allocationCacheKey.rootDeviceIndex = *rootDeviceIndices.begin();
+        this->allocationCacheKey.allocationType = allocationType;
+        this->allocationCacheKey.deviceAllocation = this->isDeviceEventPoolAllocation;
+        this->allocationCacheKey.deviceBitfield = this->isDeviceEventPoolAllocation ? neoDevice->getDeviceBitfield().to_ullong() : systemMemoryBitfield.to_ullong();
+
+        auto cachedAllocation = driverHandleImp->eventPoolAllocationCache.acquire(this->allocationCacheKey, *driver->getMemoryManager());
+        if (cachedAllocation) {
+            eventPoolAllocations->addAllocation(cachedAllocation);
+            this->isHostVisibleEventPoolAllocation = this->isDeviceEventPoolAllocation ? !(isEventPoolDeviceAllocationFlagSet()) : true;
+            if (!this->isDeviceEventPoolAllocation) {
+                eventPoolPtr = cachedAllocation->getUnderlyingBuffer();
+            }
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     if (this->isDeviceEventPoolAllocation) {
         this->isHostVisibleEventPoolAllocation = !(isEventPoolDeviceAllocationFlagSet());
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, neoDevice->getDeviceBitfield()};
@@ -156,8 +178,13 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
 EventPool::~EventPool() {
     if (eventPoolAllocations) {
         auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
-        auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
+        auto driverHandle = static_cast<DriverHandleImp *>(devices[0]->getDriverHandle());
+        auto memoryManager = driverHandle->getMemoryManager();
         for (auto gpuAllocation : graphicsAllocations) {
+            if (gpuAllocation && this->allocationCacheable && !this->isImportedIpcPool &&
+                driverHandle->eventPoolAllocationCache.release(this->allocationCacheKey, gpuAllocation)) {
+                continue;
+            }
             memoryManager->freeGraphicsMemory(gpuAllocation);
         }
     }
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_pool_allocation_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+namespace L0 {
+
+bool EventPoolAllocationCache::isEnabled() {
+    return NEO::debugManager.flags.EnableEventPoolAllocationCache.get() == 1;
+}
+
+NEO::GraphicsAllocation *EventPoolAllocationCache::acquire(const EventPoolAllocationCacheKey &key, NEO::MemoryManager &memoryManager) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (it->key == key && !memoryManager.allocInUse(*it->allocation)) {
+            auto allocation = it->allocation;
+            entries.erase(it);
+            hitCount++;
+            return allocation;
+        }
+    }
+    missCount++;
+    return nullptr;
+}
+
+bool EventPoolAllocationCache::release(const EventPoolAllocationCacheKey &key, NEO::GraphicsAllocation *allocation) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (entries.size() >= maxCachedAllocations) {
+        return false;
+    }
+    entries.push_back({key, allocation});
+    return true;
+}
+
+void EventPoolAllocationCache::trim(NEO::MemoryManager &memoryManager) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &entry : entries) {
+        memoryManager.freeGraphicsMemory(entry.allocation);
+    }
+    entries.clear();
+}
+
+uint64_t EventPoolAllocationCache::getHitCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hitCount;
+}
+
+uint64_t EventPoolAllocationCache::getMissCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return missCount;
+}
+
+double EventPoolAllocationCache::getHitRate() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto requests = hitCount + missCount;
+    return requests == 0 ? 0.0 : static_cast<double>(hitCount) / static_cast<double>(requests);
+}
+
+size_t EventPoolAllocationCache::getCachedAllocationsCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+} // namespace L0
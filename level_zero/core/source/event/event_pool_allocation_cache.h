@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/allocation_type.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+} // namespace NEO
+
+namespace L0 {
+
+struct EventPoolAllocationCacheKey {
+    size_t size = 0;
+    uint64_t deviceBitfield = 0;
+    uint32_t rootDeviceIndex = 0;
+    NEO::AllocationType allocationType = NEO::AllocationType::unknown;
+    bool deviceAllocation = false;
+
+    bool operator==(const EventPoolAllocationCacheKey &other) const {
+        return size == other.size &&
+               deviceBitfield == other.deviceBitfield &&
+               rootDeviceIndex == other.rootDeviceIndex &&
+               allocationType == other.allocationType &&
+               deviceAllocation == other.deviceAllocation;
+    }
+};
+
+// Driver wide cache of event pool backing storage. Allocations of destroyed pools are kept resident and handed
+// to the next pool with the same layout once all GPU work using them has completed.
+class EventPoolAllocationCache : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxCachedAllocations = 64u;
+
+    static bool isEnabled();
+
+    NEO::GraphicsAllocation *acquire(const EventPoolAllocationCacheKey &key, NEO::MemoryManager &memoryManager);
+    bool release(const EventPoolAllocationCacheKey &key, NEO::GraphicsAllocation *allocation);
+    void trim(NEO::MemoryManager &memoryManager);
+
+    uint64_t getHitCount() const;
+    uint64_t getMissCount() const;
+    double getHitRate() const;
+    size_t getCachedAllocationsCount() const;
+
+  protected:
+    struct Entry {
+        EventPoolAllocationCacheKey key;
+        NEO::GraphicsAllocation *allocation = nullptr;
+    };
+
+    std::vector<Entry> entries;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    mutable std::mutex mutex;
+};
+
+} // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "level_zero/core/source/fence/fence.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/execution_environment/execution_environment.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 
@@ -67,6 +68,7 @@ ze_result_t Fence::hostSynchronize(uint64_t timeout) {
         ret = queryStatus();
         if (ret == ZE_RESULT_SUCCESS) {
             cmdQueue->printKernelsPrintfOutput(false);
+            csr->peekExecutionEnvironment().drainPrintfOutput();
             cmdQueue->checkAssert();
             return ZE_RESULT_SUCCESS;
         }
@@ -74,6 +76,7 @@ ze_result_t Fence::hostSynchronize(uint64_t timeout) {
         currentTime = std::chrono::high_resolution_clock::now();
         if (csr->checkGpuHangDetected(currentTime, lastHangCheckTime)) {
             cmdQueue->printKernelsPrintfOutput(true);
+            csr->peekExecutionEnvironment().drainPrintfOutput();
             cmdQueue->checkAssert();
             return ZE_RESULT_ERROR_DEVICE_LOST;
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
+#include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/work_size_info.h"
@@ -61,6 +62,12 @@ namespace L0 {
 KernelImmutableData::KernelImmutableData(L0::Device *l0device) : device(l0device) {}
 
 KernelImmutableData::~KernelImmutableData() {
+    if (NEO::PrefetchManager::isAdaptivePrefetchEnabled() && this->device && this->kernelDescriptor) {
+        auto prefetchManager = this->getDevice()->getNEODevice()->getMemoryManager()->getPrefetchManager();
+        if (prefetchManager) {
+            prefetchManager->removeKernelHistory(*this->kernelDescriptor);
+        }
+    }
     if (nullptr != isaGraphicsAllocation) {
         this->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(isaGraphicsAllocation.release());
     }
@@ -253,6 +260,14 @@ ze_result_t KernelImp::getBaseAddress(uint64_t *baseAddress) {
 KernelImp::KernelImp(Module *module) : module(module) {}
 
 KernelImp::~KernelImp() {
+    if (kernelImmData) {
+        PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintIndirectDataReuseStatistics.get(), stdout,
+                           "Kernel %s: indirect data reused %llu times, %llu bytes of payload upload saved\n",
+                           kernelImmData->getDescriptor().kernelMetadata.kernelName.c_str(),
+                           static_cast<unsigned long long>(indirectDataCache->getReuseCount()),
+                           static_cast<unsigned long long>(indirectDataCache->getBytesSaved()));
+    }
+
     if (nullptr != privateMemoryGraphicsAllocation) {
         module->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(privateMemoryGraphicsAllocation);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/command_container/dispatch_template_cache.h"
+#include "shared/source/command_container/indirect_data_cache.h"
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
@@ -160,6 +162,8 @@ struct KernelImp : Kernel {
 
     uint32_t getRequiredWorkgroupOrder() const override { return requiredWorkgroupOrder; }
     bool requiresGenerationOfLocalIdsByRuntime() const override { return kernelRequiresGenerationOfLocalIdsByRuntime; }
+    NEO::DispatchTemplateCache *getDispatchTemplateCache() const override { return dispatchTemplateCache.get(); }
+    NEO::IndirectDataCache *getIndirectDataCache() const override { return indirectDataCache.get(); }
     bool getKernelRequiresUncachedMocs() { return (kernelRequiresUncachedMocsCount > 0); }
     bool getKernelRequiresQueueUncachedMocs() { return (kernelRequiresQueueUncachedMocsCount > 0); }
     void setKernelArgUncached(uint32_t index, bool val) { isArgUncached[index] = val; }
@@ -270,6 +274,8 @@ struct KernelImp : Kernel {
     std::unique_ptr<NEO::ImplicitArgs> pImplicitArgs;
 
     std::unique_ptr<KernelExt> pExtension;
+    std::unique_ptr<NEO::DispatchTemplateCache> dispatchTemplateCache = std::make_unique<NEO::DispatchTemplateCache>();
+    std::unique_ptr<NEO::IndirectDataCache> indirectDataCache = std::make_unique<NEO::IndirectDataCache>();
 
     struct SuggestGroupSizeCacheEntry {
         Vec3<size_t> groupSize;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/source/program/printf_output_streamer.h"
 
 #include "level_zero/core/source/device/device_imp.h"
 
@@ -68,12 +69,17 @@ void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
         }
     }
 
-    NEO::PrintFormatter printfFormatter{
-        printfOutputBuffer,
-        printfOutputSize,
-        using32BitGpuPointers,
-        usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr};
-    printfFormatter.printKernelOutput();
+    auto stringLiteralMap = usesStringMap ? kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr;
+    if (NEO::PrintfOutputStreamer::isEnabled()) {
+        device->getNEODevice()->getExecutionEnvironment()->initializePrintfOutputStreamer()->submit(printfOutputBuffer, printfOutputSize, using32BitGpuPointers, stringLiteralMap);
+    } else {
+        NEO::PrintFormatter printfFormatter{
+            printfOutputBuffer,
+            printfOutputSize,
+            using32BitGpuPointers,
+            stringLiteralMap.get()};
+        printfFormatter.printKernelOutput();
+    }
 
     *reinterpret_cast<uint32_t *>(printfBuffer->getUnderlyingBuffer()) =
         PrintfHandler::printfSurfaceInitialDataSize;
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+struct ExecuteRateResult {
+    double microsecondsPerCall = 0.0;
+    double microsecondsPerCommandList = 0.0;
+    bool validationSuccessful = false;
+};
+
+void measureExecuteRate(ze_context_handle_t context, ze_device_handle_t device, ze_command_queue_handle_t cmdQueue, uint32_t ordinal,
+                        uint32_t numCommandLists, uint32_t iterations, ExecuteRateResult &result) {
+    constexpr size_t fillSize = 64;
+
+    void *buffer = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, fillSize * numCommandLists, 1, &buffer));
+    memset(buffer, 0, fillSize * numCommandLists);
+
+    ze_command_list_desc_t cmdListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    cmdListDesc.commandQueueGroupOrdinal = ordinal;
+
+    std::vector<ze_command_list_handle_t> cmdLists(numCommandLists);
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        uint8_t pattern = static_cast<uint8_t>(i + 1);
+        SUCCESS_OR_TERMINATE(zeCommandListCreate(context, device, &cmdListDesc, &cmdLists[i]));
+        SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryFill(cmdLists[i], static_cast<uint8_t *>(buffer) + i * fillSize, &pattern, sizeof(pattern), fillSize, nullptr, 0, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandListClose(cmdLists[i]));
+    }
+
+    // warm up, first submission includes residency and state programming
+    SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, numCommandLists, cmdLists.data(), nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+
+    double executeTime = 0.0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, numCommandLists, cmdLists.data(), nullptr));
+        auto end = std::chrono::high_resolution_clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+        executeTime += std::chrono::duration<double, std::micro>(end - start).count();
+    }
+
+    result.microsecondsPerCall = executeTime / iterations;
+    result.microsecondsPerCommandList = result.microsecondsPerCall / numCommandLists;
+
+    result.validationSuccessful = true;
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        auto expected = static_cast<uint8_t>(i + 1);
+        auto chunk = static_cast<uint8_t *>(buffer) + i * fillSize;
+        result.validationSuccessful &= std::all_of(chunk, chunk + fillSize, [expected](uint8_t value) { return value == expected; });
+    }
+
+    for (auto cmdList : cmdLists) {
+        SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    }
+    SUCCESS_OR_TERMINATE(zeMemFree(context, buffer));
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Execute Rate";
+    LevelZeroBlackBoxTests::verbose = LevelZeroBlackBoxTests::isVerbose(argc, argv);
+    bool aubMode = LevelZeroBlackBoxTests::isAubMode(argc, argv);
+    uint32_t iterations = static_cast<uint32_t>(std::max(1, LevelZeroBlackBoxTests::getParamValue(argc, argv, "-i", "--iterations", 20)));
+    uint32_t maxCommandLists = static_cast<uint32_t>(std::max(1, LevelZeroBlackBoxTests::getParamValue(argc, argv, "-n", "--max-cmdlists", 4096)));
+
+    if (aubMode) {
+        iterations = 1;
+        maxCommandLists = 4;
+    }
+
+    ze_context_handle_t context = nullptr;
+    ze_driver_handle_t driverHandle = nullptr;
+    auto devices = LevelZeroBlackBoxTests::zelloInitContextAndGetDevices(context, driverHandle);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    LevelZeroBlackBoxTests::printDeviceProperties(deviceProperties);
+
+    ze_command_queue_handle_t cmdQueue;
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = LevelZeroBlackBoxTests::getCommandQueueOrdinal(device);
+    cmdQueueDesc.index = 0;
+    cmdQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    SUCCESS_OR_TERMINATE(zeCommandQueueCreate(context, device, &cmdQueueDesc, &cmdQueue));
+
+    std::cout << "Iterations per point: " << iterations << "\n"
+              << std::setw(12) << "cmdlists" << std::setw(16) << "us/call" << std::setw(16) << "us/cmdlist" << "\n";
+
+    bool outputValidationSuccessful = true;
+    for (uint32_t numCommandLists = 1; numCommandLists <= maxCommandLists; numCommandLists *= 4) {
+        ExecuteRateResult result;
+        measureExecuteRate(context, device, cmdQueue, cmdQueueDesc.ordinal, numCommandLists, iterations, result);
+        outputValidationSuccessful &= result.validationSuccessful;
+
+        std::cout << std::setw(12) << numCommandLists << std::fixed << std::setprecision(2)
+                  << std::setw(16) << result.microsecondsPerCall << std::setw(16) << result.microsecondsPerCommandList << "\n";
+    }
+
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    LevelZeroBlackBoxTests::printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return (outputValidationSuccessful ? 0 : 1);
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using TimePoint = std::chrono::high_resolution_clock::time_point;
+
+double getElapsedMicroseconds(TimePoint start, TimePoint end) {
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+double getBandwidthInGBps(size_t size, double microseconds) {
+    return static_cast<double>(size) / (microseconds * 1000.0);
+}
+
+void measureHostAllocationLatency(ze_context_handle_t &context, size_t allocSize, uint32_t iterations) {
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    std::vector<double> allocTimes;
+    std::vector<double> firstTouchTimes;
+    std::vector<double> freeTimes;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        void *hostBuffer = nullptr;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, allocSize, 1, &hostBuffer));
+        auto allocated = std::chrono::high_resolution_clock::now();
+        memset(hostBuffer, static_cast<int>(i), allocSize);
+        auto touched = std::chrono::high_resolution_clock::now();
+        SUCCESS_OR_TERMINATE(zeMemFree(context, hostBuffer));
+        auto freed = std::chrono::high_resolution_clock::now();
+
+        allocTimes.push_back(getElapsedMicroseconds(start, allocated));
+        firstTouchTimes.push_back(getElapsedMicroseconds(allocated, touched));
+        freeTimes.push_back(getElapsedMicroseconds(touched, freed));
+    }
+
+    std::sort(allocTimes.begin(), allocTimes.end());
+    std::sort(firstTouchTimes.begin(), firstTouchTimes.end());
+    std::sort(freeTimes.begin(), freeTimes.end());
+    auto median = iterations / 2;
+    std::cout << "zeMemAllocHost (registration) median latency: " << std::fixed << std::setprecision(2) << allocTimes[median] << " us\n"
+              << "First touch median latency: " << firstTouchTimes[median] << " us\n"
+              << "zeMemFree median latency: " << freeTimes[median] << " us\n";
+}
+
+bool measureCopyBandwidth(ze_context_handle_t &context, ze_device_handle_t &device, uint32_t ordinal, size_t allocSize, uint32_t iterations) {
+    ze_command_list_handle_t cmdList;
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = ordinal;
+    cmdQueueDesc.index = 0;
+    LevelZeroBlackBoxTests::selectQueueMode(cmdQueueDesc, true);
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &cmdQueueDesc, &cmdList));
+
+    void *hostBuffer = nullptr;
+    void *hostResultBuffer = nullptr;
+    void *deviceBuffer = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, allocSize, 1, &hostBuffer));
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, allocSize, 1, &hostResultBuffer));
+    SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, allocSize, 1, device, &deviceBuffer));
+
+    for (size_t i = 0; i < allocSize; i++) {
+        static_cast<uint8_t *>(hostBuffer)[i] = static_cast<uint8_t>(i);
+    }
+    memset(hostResultBuffer, 0, allocSize);
+
+    // warm up, first submission includes residency and page table setup
+    SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, deviceBuffer, hostBuffer, allocSize, nullptr, 0, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, hostResultBuffer, deviceBuffer, allocSize, nullptr, 0, nullptr));
+
+    double hostToDeviceTime = 0.0;
+    double deviceToHostTime = 0.0;
+    for (uint32_t i = 0; i < iterations; i++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, deviceBuffer, hostBuffer, allocSize, nullptr, 0, nullptr));
+        auto hostToDeviceDone = std::chrono::high_resolution_clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, hostResultBuffer, deviceBuffer, allocSize, nullptr, 0, nullptr));
+        auto deviceToHostDone = std::chrono::high_resolution_clock::now();
+
+        hostToDeviceTime += getElapsedMicroseconds(start, hostToDeviceDone);
+        deviceToHostTime += getElapsedMicroseconds(hostToDeviceDone, deviceToHostDone);
+    }
+
+    std::cout << "Host to device copy bandwidth: " << std::fixed << std::setprecision(2) << getBandwidthInGBps(allocSize, hostToDeviceTime / iterations) << " GB/s\n"
+              << "Device to host copy bandwidth: " << getBandwidthInGBps(allocSize, deviceToHostTime / iterations) << " GB/s\n";
+
+    bool outputValidationSuccessful = LevelZeroBlackBoxTests::validate(hostBuffer, hostResultBuffer, allocSize);
+
+    SUCCESS_OR_TERMINATE(zeMemFree(context, deviceBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, hostResultBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, hostBuffer));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    return outputValidationSuccessful;
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Host Memory Bandwidth";
+    LevelZeroBlackBoxTests::verbose = LevelZeroBlackBoxTests::isVerbose(argc, argv);
+    bool aubMode = LevelZeroBlackBoxTests::isAubMode(argc, argv);
+    size_t allocSize = static_cast<size_t>(LevelZeroBlackBoxTests::getParamValue(argc, argv, "-s", "--size-mb", 256)) * 1024 * 1024;
+    uint32_t iterations = static_cast<uint32_t>(std::max(1, LevelZeroBlackBoxTests::getParamValue(argc, argv, "-i", "--iterations", 10)));
+    bool useHugePages = LevelZeroBlackBoxTests::getParamValue(argc, argv, "-p", "--huge-pages", 0) == 1;
+    bool useCopyEngine = LevelZeroBlackBoxTests::getParamValue(argc, argv, "-c", "--copy-engine", 1) == 1;
+
+    if (aubMode) {
+        allocSize = 4 * 1024 * 1024;
+        iterations = 1;
+    }
+
+    if (useHugePages) {
+        LevelZeroBlackBoxTests::setEnvironmentVariable("NEOReadDebugKeys", "1");
+        LevelZeroBlackBoxTests::setEnvironmentVariable("EnableHostAllocationHugePages", "1");
+        if (LevelZeroBlackBoxTests::verbose) {
+            LevelZeroBlackBoxTests::setEnvironmentVariable("PrintHostAllocationHugePages", "1");
+        }
+    }
+
+    ze_context_handle_t context = nullptr;
+    ze_driver_handle_t driverHandle = nullptr;
+    auto devices = LevelZeroBlackBoxTests::zelloInitContextAndGetDevices(context, driverHandle);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    LevelZeroBlackBoxTests::printDeviceProperties(deviceProperties);
+
+    uint32_t ordinal = LevelZeroBlackBoxTests::getCommandQueueOrdinal(device);
+    if (useCopyEngine) {
+        auto copyOrdinal = LevelZeroBlackBoxTests::getCopyOnlyCommandQueueOrdinal(device);
+        if (copyOrdinal != std::numeric_limits<uint32_t>::max()) {
+            ordinal = copyOrdinal;
+        }
+    }
+
+    std::cout << "Allocation size: " << allocSize << " bytes, iterations: " << iterations
+              << ", huge pages: " << (useHugePages ? "requested" : "default") << "\n";
+
+    measureHostAllocationLatency(context, allocSize, iterations);
+    bool outputValidationSuccessful = measureCopyBandwidth(context, device, ordinal, allocSize, iterations);
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    LevelZeroBlackBoxTests::printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return (outputValidationSuccessful ? 0 : 1);
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+void createModule(ze_context_handle_t &context, ze_device_handle_t &device, ze_module_handle_t &module) {
+    std::string buildLog;
+    auto spirV = LevelZeroBlackBoxTests::compileToSpirV(LevelZeroBlackBoxTests::memcpyBytesTestKernelSrc, "", buildLog);
+    LevelZeroBlackBoxTests::printBuildLog(buildLog);
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+    SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+}
+
+struct LaunchRateResult {
+    double launchesPerSecond = 0.0;
+    bool validationSuccessful = false;
+};
+
+void measureLaunchRate(ze_context_handle_t context, ze_device_handle_t device, ze_module_handle_t module, uint32_t iterations, LaunchRateResult &result) {
+    constexpr size_t allocSize = 4096;
+    constexpr uint32_t groupSize = 64;
+
+    ze_command_list_handle_t cmdList;
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = LevelZeroBlackBoxTests::getCommandQueueOrdinal(device);
+    cmdQueueDesc.index = 0;
+    cmdQueueDesc.flags = ZE_COMMAND_QUEUE_FLAG_IN_ORDER;
+    LevelZeroBlackBoxTests::selectQueueMode(cmdQueueDesc, false);
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &cmdQueueDesc, &cmdList));
+
+    ze_kernel_handle_t kernel;
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "memcpy_bytes";
+    SUCCESS_OR_TERMINATE(zeKernelCreate(module, &kernelDesc, &kernel));
+    SUCCESS_OR_TERMINATE(zeKernelSetGroupSize(kernel, groupSize, 1u, 1u));
+
+    void *srcBuffer = nullptr;
+    void *dstBuffer = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, allocSize, 1, &srcBuffer));
+    SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, allocSize, 1, &dstBuffer));
+    for (size_t i = 0; i < allocSize; i++) {
+        static_cast<uint8_t *>(srcBuffer)[i] = static_cast<uint8_t>(i);
+    }
+    memset(dstBuffer, 0, allocSize);
+
+    SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 0, sizeof(dstBuffer), &dstBuffer));
+    SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 1, sizeof(srcBuffer), &srcBuffer));
+
+    ze_group_count_t dispatchTraits;
+    dispatchTraits.groupCountX = static_cast<uint32_t>(allocSize / groupSize);
+    dispatchTraits.groupCountY = 1u;
+    dispatchTraits.groupCountZ = 1u;
+
+    // warm up, first launch includes residency and template creation
+    SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandListHostSynchronize(cmdList, std::numeric_limits<uint64_t>::max()));
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    SUCCESS_OR_TERMINATE(zeCommandListHostSynchronize(cmdList, std::numeric_limits<uint64_t>::max()));
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    result.launchesPerSecond = iterations / seconds;
+    result.validationSuccessful = LevelZeroBlackBoxTests::validate(srcBuffer, dstBuffer, allocSize);
+
+    SUCCESS_OR_TERMINATE(zeMemFree(context, dstBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, srcBuffer));
+    SUCCESS_OR_TERMINATE(zeKernelDestroy(kernel));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Launch Rate";
+    LevelZeroBlackBoxTests::verbose = LevelZeroBlackBoxTests::isVerbose(argc, argv);
+    bool aubMode = LevelZeroBlackBoxTests::isAubMode(argc, argv);
+    uint32_t iterations = static_cast<uint32_t>(std::max(1, LevelZeroBlackBoxTests::getParamValue(argc, argv, "-i", "--iterations", 10000)));
+    uint32_t numThreads = static_cast<uint32_t>(std::max(1, LevelZeroBlackBoxTests::getParamValue(argc, argv, "-t", "--threads", 1)));
+    int dispatchTemplateCache = LevelZeroBlackBoxTests::getParamValue(argc, argv, "-c", "--template-cache", -1);
+
+    if (aubMode) {
+        iterations = 10;
+        numThreads = 1;
+    }
+
+    if (dispatchTemplateCache != -1) {
+        LevelZeroBlackBoxTests::setEnvironmentVariable("NEOReadDebugKeys", "1");
+        LevelZeroBlackBoxTests::setEnvironmentVariable("EnableDispatchTemplateCache", std::to_string(dispatchTemplateCache).c_str());
+    }
+
+    ze_context_handle_t context = nullptr;
+    ze_driver_handle_t driverHandle = nullptr;
+    auto devices = LevelZeroBlackBoxTests::zelloInitContextAndGetDevices(context, driverHandle);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    LevelZeroBlackBoxTests::printDeviceProperties(deviceProperties);
+
+    ze_module_handle_t module = nullptr;
+    createModule(context, device, module);
+
+    std::vector<LaunchRateResult> results(numThreads);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < numThreads; i++) {
+        threads.emplace_back(measureLaunchRate, context, device, module, iterations, std::ref(results[i]));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    bool outputValidationSuccessful = true;
+    double totalLaunchesPerSecond = 0.0;
+    for (uint32_t i = 0; i < numThreads; i++) {
+        outputValidationSuccessful &= results[i].validationSuccessful;
+        totalLaunchesPerSecond += results[i].launchesPerSecond;
+        if (LevelZeroBlackBoxTests::verbose) {
+            std::cout << "Thread " << i << ": " << std::fixed << std::setprecision(0) << results[i].launchesPerSecond << " launches/s\n";
+        }
+    }
+
+    std::cout << "Threads: " << numThreads << ", launches per thread: " << iterations
+              << ", dispatch template cache: " << (dispatchTemplateCache == -1 ? "default" : (dispatchTemplateCache ? "enabled" : "disabled")) << "\n"
+              << "Launch rate per host thread: " << std::fixed << std::setprecision(0) << totalLaunchesPerSecond / numThreads << " launches/s\n"
+              << "Total launch rate: " << totalLaunchesPerSecond << " launches/s\n";
+
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    LevelZeroBlackBoxTests::printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return (outputValidationSuccessful ? 0 : 1);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -209,6 +209,7 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenNotEnoughSpaceInCommandStreamWhenA
         nullptr,                                    // cpuWalkerBuffer
         nullptr,                                    // cpuPayloadBuffer
         nullptr,                                    // outImplicitArgsPtr
+        nullptr,                                    // outIndirectDataPtr
         nullptr,                                    // additionalCommands
         PreemptionMode::MidBatch,                   // preemptionMode
         NEO::RequiredPartitionDim::none,            // requiredPartitionDim
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -3145,5 +3145,276 @@ HWTEST2_F(CommandListAppendLaunchKernel,
     EXPECT_EQ(kernelAllocationIt, cmdlistResidency.end());
 }
 
+HWTEST2_F(CommandListAppendLaunchKernel,
+          givenCommandListWithoutMutableCommandsWhenGettingNextCommandIdThenUnsupportedFeatureIsReturned,
+          IsAtLeastXeHpCore) {
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    commandList->enableMutableCommands();
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextCommandId(&commandIdDesc, &commandId));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel,
+          givenClosedMutableCommandListWhenGettingNextCommandIdThenNotAvailableIsReturnedUntilReset,
+          IsAtLeastXeHpCore) {
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    if (commandList->isHeaplessModeEnabled()) {
+        GTEST_SKIP();
+    }
+    commandList->enableMutableCommands();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    commandList->close();
+    EXPECT_FALSE(commandList->mutableCommandPending);
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    commandList->reset();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+    EXPECT_EQ(1u, commandId);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel,
+          givenPendingMutableCommandIdWhenOtherCommandsAreAppendedBeforeKernelThenKernelIsNotRecordedAndIdStaysUnbound,
+          IsAtLeastXeHpCore) {
+    Mock<::L0::KernelImp> kernel;
+    auto mockModule = std::unique_ptr<Module>(new Mock<Module>(device, nullptr));
+    kernel.module = mockModule.get();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    if (commandList->isHeaplessModeEnabled()) {
+        GTEST_SKIP();
+    }
+    commandList->enableMutableCommands();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT;
+    uint64_t barrierCommandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &barrierCommandId));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr, false));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_FALSE(commandList->mutableCommandPending);
+    EXPECT_EQ(nullptr, commandList->mutableKernelDispatches[barrierCommandId - 1].kernel);
+
+    uint64_t builtInCommandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &builtInCommandId));
+    EXPECT_NE(barrierCommandId, builtInCommandId);
+    launchParams.isBuiltInKernel = true;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_FALSE(commandList->mutableCommandPending);
+    EXPECT_EQ(nullptr, commandList->mutableKernelDispatches[builtInCommandId - 1].kernel);
+
+    ze_group_count_t newGroupCount{2, 1, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = barrierCommandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &groupCountDesc;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+    groupCountDesc.commandId = builtInCommandId;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel,
+          givenPendingMutableCommandIdWhenIndirectKernelIsAppendedThenUnsupportedFeatureIsReturnedBeforeEncoding,
+          IsAtLeastXeHpCore) {
+    Mock<::L0::KernelImp> kernel;
+    auto mockModule = std::unique_ptr<Module>(new Mock<Module>(device, nullptr));
+    kernel.module = mockModule.get();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    if (commandList->isHeaplessModeEnabled()) {
+        GTEST_SKIP();
+    }
+    commandList->enableMutableCommands();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    auto usedBefore = commandList->getCmdContainer().getCommandStream()->getUsed();
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    launchParams.isIndirect = true;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(usedBefore, commandList->getCmdContainer().getCommandStream()->getUsed());
+    EXPECT_FALSE(commandList->mutableCommandPending);
+    EXPECT_EQ(nullptr, commandList->mutableKernelDispatches[commandId - 1].kernel);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel,
+          givenMutableKernelCommandWhenArgumentGroupCountAndGlobalOffsetAreUpdatedThenRecordedWalkerAndPayloadArePatched,
+          IsAtLeastXeHpCore) {
+    using WalkerType = typename FamilyType::DefaultWalkerType;
+
+    Mock<::L0::KernelImp> kernel;
+    auto mockModule = std::unique_ptr<Module>(new Mock<Module>(device, nullptr));
+    kernel.module = mockModule.get();
+    kernel.descriptor.kernelAttributes.flags.passInlineData = false;
+    kernel.perThreadDataSizeForWholeThreadGroup = 0;
+    kernel.crossThreadDataSize = 64;
+    kernel.crossThreadData = std::make_unique<uint8_t[]>(kernel.crossThreadDataSize);
+    memset(kernel.crossThreadData.get(), 0, kernel.crossThreadDataSize);
+
+    auto &payloadMappings = kernel.descriptor.payloadMappings;
+    payloadMappings.dispatchTraits.numWorkGroups[0] = 0;
+    payloadMappings.dispatchTraits.numWorkGroups[1] = 4;
+    payloadMappings.dispatchTraits.numWorkGroups[2] = 8;
+    payloadMappings.dispatchTraits.globalWorkOffset[0] = 12;
+    payloadMappings.dispatchTraits.globalWorkOffset[1] = 16;
+    payloadMappings.dispatchTraits.globalWorkOffset[2] = 20;
+    payloadMappings.explicitArgs.resize(1);
+    auto &valueArg = payloadMappings.explicitArgs[0].as<NEO::ArgDescValue>(true);
+    NEO::ArgDescValue::Element element;
+    element.offset = 32;
+    element.size = sizeof(uint32_t);
+    valueArg.elements.push_back(element);
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    if (commandList->isHeaplessModeEnabled()) {
+        GTEST_SKIP();
+    }
+    commandList->enableMutableCommands();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS | ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT | ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+    EXPECT_EQ(1u, commandId);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList->appendLaunchKernel(kernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+
+    auto &dispatch = commandList->mutableKernelDispatches[0];
+    ASSERT_NE(nullptr, dispatch.walker);
+    ASSERT_NE(nullptr, dispatch.indirectData);
+    EXPECT_EQ(0u, dispatch.inlineDataSize);
+
+    uint32_t argValue = 0x1234;
+    ze_group_count_t newGroupCount{4, 2, 1};
+    ze_mutable_kernel_argument_exp_desc_t argDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    argDesc.commandId = commandId;
+    argDesc.argIndex = 0;
+    argDesc.argSize = sizeof(argValue);
+    argDesc.pArgValue = &argValue;
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+    ze_mutable_global_offset_exp_desc_t offsetDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC};
+    offsetDesc.commandId = commandId;
+    offsetDesc.offsetX = 7;
+    offsetDesc.offsetY = 8;
+    offsetDesc.offsetZ = 9;
+    argDesc.pNext = &groupCountDesc;
+    groupCountDesc.pNext = &offsetDesc;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &argDesc;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    auto walker = reinterpret_cast<WalkerType *>(dispatch.walker);
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(1u, walker->getThreadGroupIdZDimension());
+
+    auto payload = reinterpret_cast<const uint32_t *>(dispatch.indirectData);
+    EXPECT_EQ(4u, payload[0]);
+    EXPECT_EQ(2u, payload[1]);
+    EXPECT_EQ(1u, payload[2]);
+    EXPECT_EQ(7u, payload[3]);
+    EXPECT_EQ(8u, payload[4]);
+    EXPECT_EQ(9u, payload[5]);
+    EXPECT_EQ(argValue, payload[8]);
+
+    argDesc.pNext = nullptr;
+    argDesc.commandId = commandId + 1;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    commandList->reset();
+    EXPECT_EQ(0u, commandList->mutableKernelDispatches.size());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel,
+          givenMutableKernelCommandWithSignalEventWhenSignalEventIsUpdatedThenWalkerPostSyncTargetsNewEvent,
+          IsAtLeastXeHpCore) {
+    using WalkerType = typename FamilyType::DefaultWalkerType;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SignalAllEventPackets.set(0);
+
+    Mock<::L0::KernelImp> kernel;
+    auto mockModule = std::unique_ptr<Module>(new Mock<Module>(device, nullptr));
+    kernel.module = mockModule.get();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    auto result = commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    if (commandList->isHeaplessModeEnabled() || commandList->partitionCount > 1) {
+        GTEST_SKIP();
+    }
+    commandList->enableMutableCommands();
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 2;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 0;
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    eventDesc.index = 1;
+    auto newEvent = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event.get());
+    ASSERT_NE(nullptr, newEvent.get());
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList->appendLaunchKernel(kernel.toHandle(), groupCount, event->toHandle(), 0, nullptr, launchParams, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+    if (!commandList->mutableKernelDispatches[0].signalEventPatchable) {
+        EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableCommandSignalEvent(commandId, newEvent->toHandle()));
+        GTEST_SKIP();
+    }
+
+    auto walker = reinterpret_cast<WalkerType *>(commandList->mutableKernelDispatches[0].walker);
+    EXPECT_EQ(event->getPacketAddress(device), walker->getPostSync().getDestinationAddress());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommandSignalEvent(commandId, newEvent->toHandle()));
+    EXPECT_EQ(newEvent->getPacketAddress(device), walker->getPostSync().getDestinationAddress());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommandWaitEvents(commandId, 0, nullptr));
+}
+
 } // namespace ult
 } // namespace L0
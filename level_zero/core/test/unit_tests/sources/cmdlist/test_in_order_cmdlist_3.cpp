@@ -1,11 +1,13 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/mocks/mock_printf_output_streamer.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/api/driver_experimental/public/zex_api.h"
@@ -232,5 +234,268 @@ HWTEST2_F(InOrderIpcTests, givenTbxModeWhenOpenIsCalledThenSetAllocationParams,
     zeEventDestroy(newEvent);
 }
 
+using InOrderGraphCaptureTests = InOrderCmdListFixture;
+
+HWTEST2_F(InOrderGraphCaptureTests, givenRegularCmdListWhenGraphCaptureIsRequestedThenReturnUnsupportedFeature, MatchAny) {
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(false);
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, regularCmdList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, regularCmdList->endGraphCapture(&hGraph));
+    EXPECT_EQ(nullptr, hGraph);
+}
+
+HWTEST2_F(InOrderGraphCaptureTests, givenImmCmdListWhenGraphCaptureIsActiveThenAppendsAreRecordedIntoInOrderRegularCmdListWithoutSubmission, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, immCmdList->endGraphCapture(&hGraph));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+    EXPECT_TRUE(immCmdList->isGraphCaptureActive());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, immCmdList->beginGraphCapture());
+
+    auto taskCount = ultCsr->taskCount.load();
+    auto immCmdStreamUsed = immCmdList->getCmdContainer().getCommandStream()->getUsed();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendBarrier(nullptr, 0, nullptr, false));
+
+    EXPECT_EQ(taskCount, ultCsr->taskCount.load());
+    EXPECT_EQ(immCmdStreamUsed, immCmdList->getCmdContainer().getCommandStream()->getUsed());
+    EXPECT_EQ(0u, immCmdList->inOrderExecInfo->getCounterValue());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, immCmdList->appendCommandLists(0u, nullptr, nullptr, 0u, nullptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->endGraphCapture(&hGraph));
+    EXPECT_FALSE(immCmdList->isGraphCaptureActive());
+    ASSERT_NE(nullptr, hGraph);
+
+    auto graph = static_cast<CommandListImp *>(CommandList::fromHandle(hGraph));
+    EXPECT_FALSE(graph->isImmediateType());
+    EXPECT_TRUE(graph->isInOrderExecutionEnabled());
+    EXPECT_EQ(immCmdList->getCmdListContext(), graph->getCmdListContext());
+    EXPECT_NE(0u, graph->getCmdContainer().getCommandStream()->getUsed());
+
+    graph->destroy();
+}
+
+HWTEST2_F(InOrderGraphCaptureTests, givenCapturedGraphWhenReplayedOnInOrderImmCmdListThenReplayIsChainedIntoImmCmdListCounter, MatchAny) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto cmdStream = immCmdList->getCmdContainer().getCommandStream();
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->endGraphCapture(&hGraph));
+    ASSERT_NE(nullptr, hGraph);
+    EXPECT_TRUE(CommandList::fromHandle(hGraph)->isCapturedGraph());
+    EXPECT_FALSE(immCmdList->isCapturedGraph());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendCommandLists(1u, &hGraph, nullptr, 0u, nullptr));
+    EXPECT_EQ(1u, immCmdList->inOrderExecInfo->getCounterValue());
+
+    auto offset = cmdStream->getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendCommandLists(1u, &hGraph, nullptr, 0u, nullptr));
+    EXPECT_EQ(2u, immCmdList->inOrderExecInfo->getCounterValue());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, ptrOffset(cmdStream->getCpuBase(), offset), cmdStream->getUsed() - offset));
+    auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end());
+    ASSERT_FALSE(semaphores.empty());
+    auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[0]);
+    EXPECT_EQ(1u, semaphoreCmd->getSemaphoreDataDword());
+
+    if (!immCmdList->dcFlushSupport) {
+        auto hostAddress = immCmdList->inOrderExecInfo->isHostStorageDuplicated() ? immCmdList->inOrderExecInfo->getBaseHostAddress()
+                                                                                 : static_cast<uint64_t *>(immCmdList->inOrderExecInfo->getDeviceCounterAllocation()->getUnderlyingBuffer());
+        *hostAddress = 1;
+        EXPECT_EQ(ZE_RESULT_NOT_READY, immCmdList->hostSynchronize(0, false));
+        EXPECT_FALSE(immCmdList->inOrderExecInfo->isCounterAlreadyDone(2));
+
+        *hostAddress = 2;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->hostSynchronize(0, false));
+        EXPECT_TRUE(immCmdList->inOrderExecInfo->isCounterAlreadyDone(2));
+    }
+
+    CommandList::fromHandle(hGraph)->destroy();
+}
+
+HWTEST2_F(InOrderGraphCaptureTests, givenRegularCmdListWhenAppendedToInOrderImmCmdListWithoutSignalEventThenImmCmdListCounterIsNotAdvanced, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(false);
+    regularCmdList->close();
+
+    auto hCmdList = regularCmdList->toHandle();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendCommandLists(1u, &hCmdList, nullptr, 0u, nullptr));
+    EXPECT_EQ(0u, immCmdList->inOrderExecInfo->getCounterValue());
+}
+
+HWTEST2_F(InOrderGraphCaptureTests, givenActiveGraphCaptureWhenMemoryPrefetchIsAppendedThenItIsForwardedToCaptureTarget, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    MockCommandList captureTarget;
+    immCmdList->graphCaptureTarget = &captureTarget;
+
+    int hostData = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendMemoryPrefetch(&hostData, sizeof(hostData)));
+    EXPECT_EQ(1u, captureTarget.appendMemoryPrefetchCalled);
+
+    immCmdList->graphCaptureTarget = nullptr;
+}
+
+HWTEST2_F(InOrderGraphCaptureTests, givenActiveGraphCaptureWhenMemAdviseIsAppendedThenItIsForwardedToCaptureTarget, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    MockCommandList captureTarget;
+    immCmdList->graphCaptureTarget = &captureTarget;
+
+    int hostData = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendMemAdvise(device->toHandle(), &hostData, sizeof(hostData), ZE_MEMORY_ADVICE_SET_READ_MOSTLY));
+    EXPECT_EQ(1u, captureTarget.appendMemAdviseCalled);
+
+    immCmdList->graphCaptureTarget = nullptr;
+}
+
+HWTEST2_F(InOrderGraphCaptureTests, givenActiveGraphCaptureWhenQueryKernelTimestampsIsAppendedThenItIsForwardedToCaptureTarget, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    MockCommandList captureTarget;
+    immCmdList->graphCaptureTarget = &captureTarget;
+
+    auto taskCount = ultCsr->taskCount.load();
+    uint64_t timestamps[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendQueryKernelTimestamps(0u, nullptr, timestamps, nullptr, nullptr, 0u, nullptr));
+    EXPECT_EQ(1u, captureTarget.appendQueryKernelTimestampsCalled);
+    EXPECT_EQ(taskCount, ultCsr->taskCount.load());
+
+    immCmdList->graphCaptureTarget = nullptr;
+}
+
+HWTEST2_F(InOrderGraphCaptureTests, givenActiveGraphCaptureWhenMultipleKernelsIndirectAreAppendedThenTheyAreForwardedToCaptureTarget, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto immCmdStreamUsed = immCmdList->getCmdContainer().getCommandStream()->getUsed();
+    MockCommandList captureTarget;
+    immCmdList->graphCaptureTarget = &captureTarget;
+
+    ze_kernel_handle_t kernelHandle = kernel->toHandle();
+    uint32_t numLaunchArguments = 1u;
+    ze_group_count_t launchArguments = {1u, 1u, 1u};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchMultipleKernelsIndirect(1u, &kernelHandle, &numLaunchArguments, &launchArguments, nullptr, 0u, nullptr, false));
+    EXPECT_EQ(1u, captureTarget.appendLaunchMultipleKernelsIndirectCalled);
+    EXPECT_EQ(immCmdStreamUsed, immCmdList->getCmdContainer().getCommandStream()->getUsed());
+
+    immCmdList->graphCaptureTarget = nullptr;
+}
+
+HWTEST2_F(InOrderGraphCaptureTests, givenActiveGraphCaptureWhenImmCmdListIsDestroyedThenCaptureTargetIsReleased, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    immCmdList.reset();
+}
+
+using ImmCmdListPrintfOutputTests = InOrderCmdListFixture;
+
+HWTEST2_F(ImmCmdListPrintfOutputTests, givenPrintfOutputStreamerWhenImmCmdListHostSynchronizeCompletesThenPrintfOutputIsDrained, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto streamer = new MockPrintfOutputStreamer();
+    device->getNEODevice()->getExecutionEnvironment()->printfOutputStreamer.reset(streamer);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->hostSynchronize(0, false));
+    EXPECT_EQ(0u, streamer->drainCalled);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->hostSynchronize(0, true));
+    EXPECT_EQ(1u, streamer->drainCalled);
+}
+
+using InOrderLaunchKernelBatchTests = InOrderCmdListFixture;
+
+HWTEST2_F(InOrderLaunchKernelBatchTests, givenImmCmdListWhenAppendingLaunchKernelBatchThenLaunchesAreSubmittedOnceAndCounterIsIncrementedPerLaunch, MatchAny) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    auto cmdStream = immCmdList->getCmdContainer().getCommandStream();
+
+    zex_kernel_launch_desc_t launches[3] = {};
+    for (auto &launch : launches) {
+        launch.hKernel = kernel->toHandle();
+        launch.groupCount = groupCount;
+    }
+
+    auto taskCount = ultCsr->taskCount.load();
+    auto offset = cmdStream->getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendLaunchKernelBatch(3u, launches, false));
+
+    EXPECT_EQ(taskCount + 1, ultCsr->taskCount.load());
+    EXPECT_EQ(3u, immCmdList->inOrderExecInfo->getCounterValue());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, ptrOffset(cmdStream->getCpuBase(), offset), cmdStream->getUsed() - offset));
+    EXPECT_EQ(3u, findAll<DefaultWalkerType *>(cmdList.begin(), cmdList.end()).size());
+}
+
+HWTEST2_F(InOrderLaunchKernelBatchTests, givenRegularCmdListWhenSameKernelIsLaunchedInBatchThenKernelResidencyIsAddedOnce, MatchAny) {
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(false);
+    auto &residencyContainer = regularCmdList->getCmdContainer().getResidencyContainer();
+    auto isaAllocation = kernel->getImmutableData()->getIsaGraphicsAllocation();
+    MockGraphicsAllocation argAllocation;
+    kernel->argumentsResidencyContainer.push_back(&argAllocation);
+
+    zex_kernel_launch_desc_t launches[3] = {};
+    for (auto &launch : launches) {
+        launch.hKernel = kernel->toHandle();
+        launch.groupCount = groupCount;
+    }
+
+    auto residencySize = residencyContainer.size();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCmdList->appendLaunchKernelBatch(3u, launches, false));
+
+    EXPECT_NE(residencySize, residencyContainer.size());
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), isaAllocation));
+    EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), &argAllocation));
+    EXPECT_EQ(3u, regularCmdList->inOrderExecInfo->getCounterValue());
+
+    kernel->argumentsResidencyContainer.pop_back();
+}
+
+HWTEST2_F(InOrderLaunchKernelBatchTests, givenInvalidKernelInBatchWhenAppendingLaunchKernelBatchThenErrorIsReturned, MatchAny) {
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(false);
+
+    zex_kernel_launch_desc_t launches[2] = {};
+    launches[0].hKernel = kernel->toHandle();
+    launches[0].groupCount = groupCount;
+    launches[1].hKernel = nullptr;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, regularCmdList->appendLaunchKernelBatch(2u, launches, false));
+}
+
+HWTEST2_F(InOrderLaunchKernelBatchTests, givenInvalidKernelInBatchWhenAppendingLaunchKernelBatchOnImmCmdListThenPrecedingLaunchesAreSubmittedAndErrorIsReturned, MatchAny) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    zex_kernel_launch_desc_t launches[3] = {};
+    launches[0].hKernel = kernel->toHandle();
+    launches[0].groupCount = groupCount;
+    launches[1].hKernel = nullptr;
+    launches[2].hKernel = kernel->toHandle();
+    launches[2].groupCount = groupCount;
+
+    auto taskCount = ultCsr->taskCount.load();
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, immCmdList->appendLaunchKernelBatch(3u, launches, false));
+    EXPECT_EQ(taskCount + 1, ultCsr->taskCount.load());
+    EXPECT_EQ(1u, immCmdList->inOrderExecInfo->getCounterValue());
+
+    taskCount = ultCsr->taskCount.load();
+    launches[0].hKernel = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, immCmdList->appendLaunchKernelBatch(3u, launches, false));
+    EXPECT_EQ(taskCount, ultCsr->taskCount.load());
+    EXPECT_EQ(1u, immCmdList->inOrderExecInfo->getCounterValue());
+}
+
 } // namespace ult
 } // namespace L0
\ No newline at end of file
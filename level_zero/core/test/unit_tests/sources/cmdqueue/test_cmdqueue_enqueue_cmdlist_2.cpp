@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -130,6 +130,97 @@ HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, whenUsingFenceThenLastPipeC
     commandQueue->destroy();
 }
 
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenRegularCommandListWhenCreatingRecordingSegmentsThenSegmentsAreOwnedAndClosedByParent, MatchAny) {
+    ze_result_t returnValue;
+    auto commandList = CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false);
+    ASSERT_NE(nullptr, commandList);
+
+    ze_command_list_handle_t segments[3] = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->createRecordingSegments(0u, segments));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->createRecordingSegments(3u, segments));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->createRecordingSegments(3u, segments));
+
+    ASSERT_EQ(3u, commandList->getRecordingSegments().size());
+    for (auto i = 0u; i < 3u; i++) {
+        auto segment = CommandList::fromHandle(segments[i]);
+        EXPECT_EQ(commandList->getRecordingSegments()[i], segment);
+        EXPECT_TRUE(segment->isRecordingSegment());
+        EXPECT_EQ(0u, segment->getCmdContainer().getCommandStream()->getUsed());
+        EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, segment->createRecordingSegments(1u, segments));
+        EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, segment->destroy());
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+    for (auto i = 0u; i < 3u; i++) {
+        EXPECT_NE(0u, CommandList::fromHandle(segments[i])->getCmdContainer().getCommandStream()->getUsed());
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->destroy());
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenCommandListWithRecordingSegmentsWhenExecutingThenSegmentsAreChainedInSegmentOrder, MatchAny) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+
+    ze_command_queue_desc_t queueDesc = {};
+    ze_result_t returnValue;
+    auto commandQueue = whiteboxCast(CommandQueue::create(productFamily, device, neoDevice->getDefaultEngine().commandStreamReceiver, &queueDesc, false, false, false, returnValue));
+    ASSERT_NE(nullptr, commandQueue);
+
+    auto commandList = CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false);
+    ze_command_list_handle_t segments[2] = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->createRecordingSegments(2u, segments));
+    commandList->close();
+
+    std::vector<uint64_t> expectedStartAddresses = {
+        commandList->getCmdContainer().getCommandStream()->getGraphicsAllocation()->getGpuAddress(),
+        CommandList::fromHandle(segments[0])->getCmdContainer().getCommandStream()->getGraphicsAllocation()->getGpuAddress(),
+        CommandList::fromHandle(segments[1])->getCmdContainer().getCommandStream()->getGraphicsAllocation()->getGpuAddress()};
+
+    auto commandListHandle = commandList->toHandle();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandQueue->executeCommandLists(1u, &commandListHandle, nullptr, false, nullptr));
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(
+        cmdList, ptrOffset(commandQueue->commandStream.getCpuBase(), 0), commandQueue->commandStream.getUsed()));
+
+    std::vector<uint64_t> startAddresses;
+    for (auto &cmd : findAll<MI_BATCH_BUFFER_START *>(cmdList.begin(), cmdList.end())) {
+        auto address = genCmdCast<MI_BATCH_BUFFER_START *>(*cmd)->getBatchBufferStartAddress();
+        if (std::find(expectedStartAddresses.begin(), expectedStartAddresses.end(), address) != expectedStartAddresses.end()) {
+            startAddresses.push_back(address);
+        }
+    }
+    EXPECT_EQ(expectedStartAddresses, startAddresses);
+
+    commandList->destroy();
+    commandQueue->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenSameCommandListPassedSeveralTimesWhenExecutingThenItsResidencyIsMergedOncePerCall, MatchAny) {
+    auto &csr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.storeMakeResidentAllocations = true;
+
+    ze_command_queue_desc_t queueDesc = {};
+    ze_result_t returnValue;
+    auto commandQueue = whiteboxCast(CommandQueue::create(productFamily, device, &csr, &queueDesc, false, false, false, returnValue));
+    ASSERT_NE(nullptr, commandQueue);
+
+    auto commandList = CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false);
+    commandList->close();
+    auto cmdBufferAllocation = commandList->getCmdContainer().getCommandStream()->getGraphicsAllocation();
+
+    ze_command_list_handle_t commandLists[] = {commandList->toHandle(), commandList->toHandle(), commandList->toHandle()};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandQueue->executeCommandLists(3u, commandLists, nullptr, false, nullptr));
+
+    EXPECT_EQ(1u, csr.makeResidentAllocations[cmdBufferAllocation]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandQueue->executeCommandLists(1u, commandLists, nullptr, false, nullptr));
+    EXPECT_EQ(2u, csr.makeResidentAllocations[cmdBufferAllocation]);
+
+    commandList->destroy();
+    commandQueue->destroy();
+}
+
 HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenTwoCommandQueuesUsingSingleCsrWhenExecutingFirstTimeOnBothThenPipelineSelectProgrammedOnce, IsAtMostXeHpcCore) {
     using PIPELINE_SELECT = typename FamilyType::PIPELINE_SELECT;
 
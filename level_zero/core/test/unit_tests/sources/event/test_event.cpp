@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -176,6 +176,72 @@ TEST_F(EventPoolCreate, GivenEventPoolThenAllocationContainsAtLeast16Bytes) {
               minAllocationSize);
 }
 
+TEST_F(EventPoolCreate, givenEventPoolAllocationCacheEnabledWhenPoolIsDestroyedThenNextPoolWithSameLayoutReusesItsAllocation) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EnableEventPoolAllocationCache.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        4};
+
+    auto &allocationCache = driverHandle->eventPoolAllocationCache;
+    auto rootDeviceIndex = device->getNEODevice()->getRootDeviceIndex();
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto firstAllocation = eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex);
+    EXPECT_EQ(0u, allocationCache.getHitCount());
+    EXPECT_EQ(1u, allocationCache.getMissCount());
+
+    eventPool->destroy();
+    EXPECT_EQ(1u, allocationCache.getCachedAllocationsCount());
+
+    eventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(firstAllocation, eventPool->getAllocation().getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(0u, allocationCache.getCachedAllocationsCount());
+    EXPECT_EQ(1u, allocationCache.getHitCount());
+    EXPECT_DOUBLE_EQ(0.5, allocationCache.getHitRate());
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 0;
+    ze_event_handle_t eventHandle = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &eventHandle));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::fromHandle(eventHandle)->queryStatus());
+    Event::fromHandle(eventHandle)->destroy();
+
+    eventPoolDesc.count = 8;
+    auto otherEventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(2u, allocationCache.getMissCount());
+
+    otherEventPool->destroy();
+    eventPool->destroy();
+    EXPECT_EQ(2u, allocationCache.getCachedAllocationsCount());
+}
+
+TEST_F(EventPoolCreate, givenEventPoolAllocationCacheEnabledWhenIpcPoolIsDestroyedThenAllocationIsNotCached) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EnableEventPoolAllocationCache.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_IPC,
+        1};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    eventPool->destroy();
+
+    EXPECT_EQ(0u, driverHandle->eventPoolAllocationCache.getCachedAllocationsCount());
+    EXPECT_EQ(0u, driverHandle->eventPoolAllocationCache.getMissCount());
+}
+
 TEST_F(EventPoolCreate, givenInvalidPNextWhenCreatingPoolThenIgnore) {
     ze_base_desc_t baseDesc = {ZE_STRUCTURE_TYPE_FORCE_UINT32};
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_driver_model.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_printf_output_streamer.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/core/source/fence/fence.h"
@@ -177,6 +178,32 @@ TEST_F(FenceTest, GivenSuccessfulQueryResultAndNoTimeoutWhenHostSynchronizeIsCal
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(FenceTest, givenPrintfOutputStreamerWhenHostSynchronizeCompletesOrDetectsGpuHangThenPrintfOutputIsDrained) {
+    auto streamer = new MockPrintfOutputStreamer();
+    neoDevice->getExecutionEnvironment()->printfOutputStreamer.reset(streamer);
+
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->testTaskCountReadyReturnValue = true;
+
+    Mock<CommandQueue> cmdqueue(device, csr.get());
+    ze_fence_desc_t desc = {};
+
+    std::unique_ptr<WhiteBox<L0::Fence>> fence;
+    fence.reset(whiteboxCast(Fence::create(&cmdqueue, &desc)));
+    ASSERT_NE(nullptr, fence);
+
+    fence->taskCount = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fence->hostSynchronize(std::numeric_limits<std::uint32_t>::max()));
+    EXPECT_EQ(1u, streamer->drainCalled);
+
+    csr->isGpuHangDetectedReturnValue = true;
+    csr->testTaskCountReadyReturnValue = false;
+    csr->gpuHangCheckPeriod = {};
+    fence->gpuHangCheckPeriod = 0ms;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, fence->hostSynchronize(std::numeric_limits<std::uint64_t>::max()));
+    EXPECT_EQ(2u, streamer->drainCalled);
+}
+
 using FenceSynchronizeTest = Test<DeviceFixture>;
 
 TEST_F(FenceSynchronizeTest, givenCallToFenceHostSynchronizeWithTimeoutZeroAndStateInitialThenHostSynchronizeReturnsNotReady) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -3750,7 +3750,7 @@ HWTEST_F(PrintfHandlerTests, givenKernelWithPrintfWhenPrintingOutputWithBlitterU
         kernelDescriptor.kernelAttributes.binaryFormat = DeviceBinaryFormat::patchtokens;
         kernelDescriptor.kernelAttributes.gpuPointerSize = 8u;
         std::string expectedString("test123");
-        kernelDescriptor.kernelMetadata.printfStringsMap.insert(std::make_pair(0u, expectedString));
+        kernelDescriptor.kernelMetadata.printfStringsMap->insert(std::make_pair(0u, expectedString));
 
         constexpr size_t size = 128;
         uint64_t gpuAddress = 0x2000;
@@ -3814,7 +3814,7 @@ HWTEST_F(PrintfHandlerTests, givenPrintDebugMessagesAndKernelWithPrintfWhenBlitt
         kernelDescriptor.kernelAttributes.binaryFormat = DeviceBinaryFormat::patchtokens;
         kernelDescriptor.kernelAttributes.gpuPointerSize = 8u;
         std::string expectedString("test123");
-        kernelDescriptor.kernelMetadata.printfStringsMap.insert(std::make_pair(0u, expectedString));
+        kernelDescriptor.kernelMetadata.printfStringsMap->insert(std::make_pair(0u, expectedString));
 
         constexpr size_t size = 128;
         uint64_t gpuAddress = 0x2000;
@@ -3850,7 +3850,7 @@ TEST_F(KernelPatchtokensPrintfStringMapTests, givenKernelWithPrintfStringsMapUsa
     kernelDescriptor->kernelAttributes.flags.usesStringMapForPrintf = true;
     kernelDescriptor->kernelAttributes.binaryFormat = DeviceBinaryFormat::patchtokens;
     std::string expectedString("test123");
-    kernelDescriptor->kernelMetadata.printfStringsMap.insert(std::make_pair(0u, expectedString));
+    kernelDescriptor->kernelMetadata.printfStringsMap->insert(std::make_pair(0u, expectedString));
 
     createModuleFromMockBinary(0u, false, mockKernelImmData.get());
 
@@ -3878,7 +3878,7 @@ TEST_F(KernelPatchtokensPrintfStringMapTests, givenKernelWithPrintfStringsMapUsa
     kernelDescriptor->kernelAttributes.flags.requiresImplicitArgs = false;
     kernelDescriptor->kernelAttributes.binaryFormat = DeviceBinaryFormat::patchtokens;
     std::string expectedString("test123");
-    kernelDescriptor->kernelMetadata.printfStringsMap.insert(std::make_pair(0u, expectedString));
+    kernelDescriptor->kernelMetadata.printfStringsMap->insert(std::make_pair(0u, expectedString));
 
     createModuleFromMockBinary(0u, false, mockKernelImmData.get());
 
@@ -3906,7 +3906,7 @@ TEST_F(KernelPatchtokensPrintfStringMapTests, givenKernelWithPrintfStringsMapUsa
     kernelDescriptor->kernelAttributes.flags.requiresImplicitArgs = true;
     kernelDescriptor->kernelAttributes.binaryFormat = DeviceBinaryFormat::patchtokens;
     std::string expectedString("test123");
-    kernelDescriptor->kernelMetadata.printfStringsMap.insert(std::make_pair(0u, expectedString));
+    kernelDescriptor->kernelMetadata.printfStringsMap->insert(std::make_pair(0u, expectedString));
 
     createModuleFromMockBinary(0u, false, mockKernelImmData.get());
 
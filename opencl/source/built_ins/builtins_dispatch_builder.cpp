@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,7 +38,6 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
         uintptr_t start = reinterpret_cast<uintptr_t>(operationParams.dstPtr) + operationParams.dstOffset.x;
 
         size_t middleAlignment = MemoryConstants::cacheLineSize;
-        size_t middleElSize = sizeof(uint32_t) * 4;
 
         uintptr_t leftSize = start % middleAlignment;
         leftSize = (leftSize > 0) ? (middleAlignment - leftSize) : 0; // calc left leftover size
@@ -54,6 +53,10 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
         const auto srcMisalignment = srcMiddleStart % sizeof(uint32_t);
         const auto isSrcMisaligned = srcMisalignment != 0u;
 
+        // middle region is a multiple of cache line size, so it can always be split into 32 byte elements
+        const bool useWideMiddle = !isSrcMisaligned && isWideCopyKernelPreferred(middleSizeBytes);
+        const size_t middleElSize = useWideMiddle ? sizeof(uint32_t) * 8 : sizeof(uint32_t) * 4;
+
         auto middleSizeEls = middleSizeBytes / middleElSize; // num work items in middle walker
 
         uint32_t rootDeviceIndex = clDevice.getRootDeviceIndex();
@@ -62,6 +65,8 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::left, kernLeftLeftover->getKernel(rootDeviceIndex));
         if (isSrcMisaligned) {
             kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddleMisaligned->getKernel(rootDeviceIndex));
+        } else if (useWideMiddle) {
+            kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddleWide->getKernel(rootDeviceIndex));
         } else {
             kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::middle, kernMiddle->getKernel(rootDeviceIndex));
         }
@@ -123,6 +128,7 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
     MultiDeviceKernel *kernMiddleMisaligned = nullptr;
+    MultiDeviceKernel *kernMiddleWide = nullptr;
     MultiDeviceKernel *kernRightLeftover = nullptr;
     BuiltInOp(BuiltIns &kernelsLib, ClDevice &device, bool populateKernels)
         : BuiltinDispatchInfoBuilder(kernelsLib, device) {
@@ -132,6 +138,7 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
                      "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                      "CopyBufferToBufferMiddle", kernMiddle,
                      "CopyBufferToBufferMiddleMisaligned", kernMiddleMisaligned,
+                     "CopyBufferToBufferMiddleWide", kernMiddleWide,
                      "CopyBufferToBufferRightLeftover", kernRightLeftover);
         }
     }
@@ -147,6 +154,7 @@ class BuiltInOp<EBuiltInOps::copyBufferToBufferStateless> : public BuiltInOp<EBu
                  "CopyBufferToBufferLeftLeftoverStateless", kernLeftLeftover,
                  "CopyBufferToBufferMiddleStateless", kernMiddle,
                  "CopyBufferToBufferMiddleMisalignedStateless", kernMiddleMisaligned,
+                 "CopyBufferToBufferMiddleWideStateless", kernMiddleWide,
                  "CopyBufferToBufferRightLeftoverStateless", kernRightLeftover);
     }
 
@@ -165,6 +173,7 @@ class BuiltInOp<EBuiltInOps::copyBufferToBufferStatelessHeapless> : public Built
                  "CopyBufferToBufferLeftLeftoverStateless", kernLeftLeftover,
                  "CopyBufferToBufferMiddleStateless", kernMiddle,
                  "CopyBufferToBufferMiddleMisalignedStateless", kernMiddleMisaligned,
+                 "CopyBufferToBufferMiddleWideStateless", kernMiddleWide,
                  "CopyBufferToBufferRightLeftoverStateless", kernRightLeftover);
     }
 
@@ -181,7 +190,7 @@ class BuiltInOp<EBuiltInOps::copyBufferRect> : public BuiltinDispatchInfoBuilder
 
     template <typename OffsetType>
     bool buildDispatchInfosTyped(MultiDispatchInfo &multiDispatchInfo) const {
-        auto &operationParams = multiDispatchInfo.peekBuiltinOpParams();
+        auto operationParams = multiDispatchInfo.peekBuiltinOpParams();
 
         size_t hostPtrSize = 0;
         size_t srcOffsetFromAlignedPtr = 0;
@@ -230,6 +239,16 @@ class BuiltInOp<EBuiltInOps::copyBufferRect> : public BuiltinDispatchInfoBuilder
                 return true;
             }
 
+            // rows without padding between them form one contiguous row, copy it with a single set of walkers
+            if (!is3D && operationParams.size.y > 1 && operationParams.size.x == operationParams.srcRowPitch && operationParams.size.x == operationParams.dstRowPitch) {
+                operationParams.srcOffset.x += operationParams.srcOffset.y * operationParams.srcRowPitch;
+                operationParams.dstOffset.x += operationParams.dstOffset.y * operationParams.dstRowPitch;
+                operationParams.srcOffset.y = 0;
+                operationParams.dstOffset.y = 0;
+                operationParams.size.x *= operationParams.size.y;
+                operationParams.size.y = 1;
+            }
+
             const uintptr_t start = reinterpret_cast<uintptr_t>(dstPtr) + operationParams.dstOffset.x;
 
             constexpr size_t middleAlignment = MemoryConstants::cacheLineSize;
@@ -1038,4 +1057,20 @@ std::unique_ptr<Program> BuiltinDispatchInfoBuilder::createProgramFromCode(const
     return ret;
 }
 
+void BuiltinDispatchInfoBuilder::cacheProgramBinary(BuiltinsLib &builtinsLib, const std::string &cacheKey, Program &program) {
+    if (cacheKey.empty()) {
+        return;
+    }
+    size_t binarySize = 0u;
+    if (program.getInfo(CL_PROGRAM_BINARY_SIZES, sizeof(binarySize), &binarySize, nullptr) != CL_SUCCESS || binarySize == 0u) {
+        return;
+    }
+    auto binary = std::make_unique<unsigned char[]>(binarySize);
+    unsigned char *binaries[] = {binary.get()};
+    if (program.getInfo(CL_PROGRAM_BINARIES, sizeof(binaries), binaries, nullptr) != CL_SUCCESS) {
+        return;
+    }
+    builtinsLib.cacheBinary(cacheKey, reinterpret_cast<const char *>(binary.get()), binarySize);
+}
+
 } // namespace NEO
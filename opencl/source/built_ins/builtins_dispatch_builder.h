@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,10 +17,12 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace NEO {
 struct BuiltinCode;
+class BuiltinsLib;
 typedef std::vector<char> BuiltinResourceT;
 
 class ClDeviceVector;
@@ -84,6 +86,7 @@ class BuiltinDispatchInfoBuilder {
     std::vector<std::unique_ptr<MultiDeviceKernel>> &peekUsedKernels() { return usedKernels; }
 
     static std::unique_ptr<Program> createProgramFromCode(const BuiltinCode &bc, const ClDeviceVector &device);
+    static void cacheProgramBinary(BuiltinsLib &builtinsLib, const std::string &cacheKey, Program &program);
 
   protected:
     template <typename KernelNameT, typename... KernelsDescArgsT>
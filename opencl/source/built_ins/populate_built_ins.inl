@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,11 +10,19 @@
 namespace NEO {
 template <typename... KernelsDescArgsT>
 void BuiltinDispatchInfoBuilder::populate(EBuiltInOps::Type op, ConstStringRef options, KernelsDescArgsT &&...desc) {
-    auto src = kernelsLib.getBuiltinsLib().getBuiltinCode(op, BuiltinCode::ECodeType::any, clDevice.getDevice());
+    auto &builtinsLib = kernelsLib.getBuiltinsLib();
+    auto src = builtinsLib.getBuiltinCode(op, BuiltinCode::ECodeType::any, clDevice.getDevice());
     ClDeviceVector deviceVector;
     deviceVector.push_back(&clDevice);
     prog.reset(BuiltinDispatchInfoBuilder::createProgramFromCode(src, deviceVector).release());
-    prog->build(deviceVector, options.data());
+    const auto codeType = src.type;
+    auto binaryCacheKey = builtinsLib.loadCachedBinary(src, options, prog->getInternalOptions());
+    if (src.type != codeType) {
+        prog.reset(BuiltinDispatchInfoBuilder::createProgramFromCode(src, deviceVector).release());
+    }
+    if (prog->build(deviceVector, options.data()) == CL_SUCCESS) {
+        BuiltinDispatchInfoBuilder::cacheProgramBinary(builtinsLib, binaryCacheKey, *prog);
+    }
     grabKernels(std::forward<KernelsDescArgsT>(desc)...);
 }
 } // namespace NEO
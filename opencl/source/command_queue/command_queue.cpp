@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/command_stream/aub_subcapture_status.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debugger/debugger_l0.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/resource_info.h"
@@ -243,12 +244,16 @@ void CommandQueue::initializeGpgpuInternals() const {
     gpgpuEngine->commandStreamReceiver->requestPreallocation();
     gpgpuEngine->commandStreamReceiver->initDirectSubmission();
 
-    if (getCmdQueueProperties<cl_queue_properties>(propertiesVector.data(), CL_QUEUE_PROPERTIES) & static_cast<cl_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) && !this->gpgpuEngine->commandStreamReceiver->isUpdateTagFromWaitEnabled()) {
+    const bool outOfOrderQueue = getCmdQueueProperties<cl_queue_properties>(propertiesVector.data(), CL_QUEUE_PROPERTIES) & static_cast<cl_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    const bool batchedDispatch = outOfOrderQueue || debugManager.flags.EnableBatchedDispatchForInOrderQueues.get() == 1;
+    if (batchedDispatch && !this->gpgpuEngine->commandStreamReceiver->isUpdateTagFromWaitEnabled()) {
         this->gpgpuEngine->commandStreamReceiver->overrideDispatchPolicy(DispatchMode::batchedDispatch);
         if (debugManager.flags.CsrDispatchMode.get() != 0) {
             this->gpgpuEngine->commandStreamReceiver->overrideDispatchPolicy(static_cast<DispatchMode>(debugManager.flags.CsrDispatchMode.get()));
         }
-        this->gpgpuEngine->commandStreamReceiver->enableNTo1SubmissionModel();
+        if (outOfOrderQueue) {
+            this->gpgpuEngine->commandStreamReceiver->enableNTo1SubmissionModel();
+        }
     }
 }
 
@@ -769,6 +774,16 @@ cl_int CommandQueue::enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr,
 }
 
 void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet) {
+    if (transferProperties.mapFlags == CL_MAP_READ && transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
+        auto buffer = castToObject<Buffer>(transferProperties.memObj);
+        if (buffer->isReadOnlyMapOfLockedMemoryAllowed(getDevice())) {
+            auto lockedPtr = buffer->getMemoryManager()->lockResource(buffer->getGraphicsAllocation(getDevice().getRootDeviceIndex()));
+            if (lockedPtr) {
+                return enqueueMapLockedBufferForRead(*buffer, lockedPtr, transferProperties, eventsRequest, errcodeRet);
+            }
+        }
+    }
+
     void *basePtr = transferProperties.memObj->getBasePtrForMap(getDevice().getRootDeviceIndex());
     size_t mapPtrOffset = transferProperties.memObj->calculateOffsetForMapping(transferProperties.offset) + transferProperties.mipPtrOffset;
     if (transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
@@ -815,6 +830,35 @@ void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperti
     return returnPtr;
 }
 
+void *CommandQueue::enqueueMapLockedBufferForRead(Buffer &buffer, void *lockedPtr, TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet) {
+    void *returnPtr = ptrOffset(lockedPtr, buffer.getOffset() + transferProperties.offset[0]);
+
+    if (!buffer.addMappedPtr(returnPtr, transferProperties.size[0], transferProperties.mapFlags, transferProperties.size, transferProperties.offset, 0u, nullptr)) {
+        errcodeRet = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+
+    // returned pointer aliases the buffer storage, so all writes to it have to be completed before the map returns
+    errcodeRet = enqueueMarkerWithWaitList(eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
+    if (errcodeRet == CL_SUCCESS) {
+        errcodeRet = finish();
+    }
+    if (errcodeRet != CL_SUCCESS) {
+        buffer.removeMappedPtr(returnPtr);
+        return nullptr;
+    }
+    auto graphicsAllocation = buffer.getGraphicsAllocation(getDevice().getRootDeviceIndex());
+    if (graphicsAllocation->isUsed()) {
+        buffer.getMemoryManager()->waitForEnginesCompletion(*graphicsAllocation);
+    }
+
+    if (eventsRequest.outEvent) {
+        auto event = castToObject<Event>(*eventsRequest.outEvent);
+        event->setCmdType(transferProperties.cmdType);
+    }
+    return returnPtr;
+}
+
 void *CommandQueue::enqueueMapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet) {
     if (transferProperties.memObj->mappingOnCpuAllowed()) {
         return cpuDataTransferHandler(transferProperties, eventsRequest, errcodeRet);
@@ -1102,6 +1146,26 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::imageCpuCopyAllowed(Image *image, cl_bool blocking, const size_t *region, cl_uint numEventsInWaitList) {
+    const auto threshold = debugManager.flags.CpuImageTransferThreshold.get();
+    if (threshold <= 0) {
+        return false;
+    }
+
+    // small blocking transfers only, where dispatching a copy kernel costs more than the copy itself
+    if (blocking == CL_FALSE || numEventsInWaitList != 0) {
+        return false;
+    }
+
+    // tiled, compressed and local memory images are not accessible linearly on CPU
+    if (!image->isMemObjZeroCopy() || !image->mappingOnCpuAllowed()) {
+        return false;
+    }
+
+    const size_t transferSize = region[0] * region[1] * region[2] * image->getSurfaceFormatInfo().surfaceFormat.imageElementSizeInBytes;
+    return transferSize <= static_cast<size_t>(threshold);
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || debugManager.flags.OmitTimestampPacketDependencies.get();
 }
@@ -1409,6 +1473,7 @@ WaitStatus CommandQueue::waitForAllEngines(bool blockedQueue, PrintfHandler *pri
         if (!printfHandler->printEnqueueOutput()) {
             return WaitStatus::gpuHang;
         }
+        getDevice().getExecutionEnvironment()->drainPrintfOutput();
     }
 
     return waitStatus;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,6 +65,20 @@ cl_int CommandQueueHw<Family>::enqueueReadWriteBufferOnCpuWithMemoryTransfer(cl_
     return retVal;
 }
 
+template <typename Family>
+cl_int CommandQueueHw<Family>::enqueueReadWriteImageOnCpu(cl_command_type commandType, Image *image, const size_t *origin, const size_t *region,
+                                                          size_t hostRowPitch, size_t hostSlicePitch, void *ptr, cl_uint numEventsInWaitList,
+                                                          const cl_event *eventWaitList, cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+
+    TransferProperties transferProperties(image, commandType, 0, true, const_cast<size_t *>(origin), const_cast<size_t *>(region), ptr, true, getDevice().getRootDeviceIndex());
+    transferProperties.hostRowPitch = hostRowPitch;
+    transferProperties.hostSlicePitch = hostSlicePitch;
+    cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
+    return retVal;
+}
+
 template <typename Family>
 cl_int CommandQueueHw<Family>::enqueueReadWriteBufferOnCpuWithoutMemoryTransfer(cl_command_type commandType, Buffer *buffer,
                                                                                 size_t offset, size_t size, void *ptr, cl_uint numEventsInWaitList,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,10 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/logger.h"
 
@@ -30,6 +32,14 @@ void cachelineFlushMemory(char *ptr, size_t size) {
     CpuIntrinsics::sfence();
 }
 
+void cpuCopyMemory(ExecutionEnvironment &executionEnvironment, void *dst, const void *src, size_t size, bool writeCombinedDestination) {
+    if (CpuCopyEngine::isEnabled()) {
+        executionEnvironment.initializeCpuCopyEngine()->copy(dst, src, size, writeCombinedDestination);
+        return;
+    }
+    memcpy_s(dst, size, src, size);
+}
+
 void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &retVal) {
     MapInfo unmapInfo;
     Event *outEventObj = nullptr;
@@ -152,11 +162,20 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            cpuCopyMemory(*getDevice().getExecutionEnvironment(), transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], false);
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            cpuCopyMemory(*getDevice().getExecutionEnvironment(), transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0], transferProperties.lockedPtr != nullptr);
+            eventCompleted = true;
+            modifySimulationFlags = true;
+            break;
+        case CL_COMMAND_READ_IMAGE:
+            castToObjectOrAbort<Image>(transferProperties.memObj)->copyRegionOnCpu(transferProperties.ptr, transferProperties.hostRowPitch, transferProperties.hostSlicePitch, transferProperties.size, transferProperties.offset, false);
+            eventCompleted = true;
+            break;
+        case CL_COMMAND_WRITE_IMAGE:
+            castToObjectOrAbort<Image>(transferProperties.memObj)->copyRegionOnCpu(transferProperties.ptr, transferProperties.hostRowPitch, transferProperties.hostSlicePitch, transferProperties.size, transferProperties.offset, true);
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
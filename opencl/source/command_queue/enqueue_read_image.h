@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,6 +56,21 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadImage(
     }
 
     size_t hostPtrSize = calculateHostPtrSizeForImage(region, inputRowPitch, inputSlicePitch, srcImage);
+    bool isCpuCopyAllowed = imageCpuCopyAllowed(srcImage, blockingRead, region, numEventsInWaitList);
+    InternalMemoryType memoryType = InternalMemoryType::notSpecified;
+
+    if (!mapAllocation) {
+        cl_int retVal = getContext().tryGetExistingHostPtrAllocation(ptr, hostPtrSize, device->getRootDeviceIndex(), mapAllocation, memoryType, isCpuCopyAllowed);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+    }
+
+    if (isCpuCopyAllowed) {
+        return enqueueReadWriteImageOnCpu(cmdType, srcImage, origin, region, inputRowPitch, inputSlicePitch, ptr,
+                                          numEventsInWaitList, eventWaitList, event);
+    }
+
     void *dstPtr = ptr;
 
     MemObjSurface srcImgSurf(srcImage);
@@ -69,9 +84,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadImage(
     if (mapAllocation) {
         surfaces[1] = &mapSurface;
         mapSurface.setGraphicsAllocation(mapAllocation);
-        // get offset between base cpu ptr of map allocation and dst ptr
-        size_t dstOffset = ptrDiff(dstPtr, mapAllocation->getUnderlyingBuffer());
-        dstPtr = reinterpret_cast<void *>(mapAllocation->getGpuAddress() + dstOffset);
+        dstPtr = convertAddressWithOffsetToGpuVa(dstPtr, memoryType, *mapAllocation);
     } else {
         surfaces[1] = &hostPtrSurf;
         if (region[0] != 0 &&
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
+#include "opencl/source/context/context.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/mipmap.h"
 #include "opencl/source/mem_obj/image.h"
@@ -52,6 +53,25 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
     }
 
     size_t hostPtrSize = calculateHostPtrSizeForImage(region, inputRowPitch, inputSlicePitch, dstImage);
+    bool isCpuCopyAllowed = imageCpuCopyAllowed(dstImage, blockingWrite, region, numEventsInWaitList);
+    InternalMemoryType memoryType = InternalMemoryType::notSpecified;
+
+    if (!mapAllocation) {
+        cl_int retVal = getContext().tryGetExistingHostPtrAllocation(ptr, hostPtrSize, device->getRootDeviceIndex(), mapAllocation, memoryType, isCpuCopyAllowed);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+        if (mapAllocation) {
+            mapAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
+            mapAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+        }
+    }
+
+    if (isCpuCopyAllowed) {
+        return enqueueReadWriteImageOnCpu(cmdType, dstImage, origin, region, inputRowPitch, inputSlicePitch, const_cast<void *>(ptr),
+                                          numEventsInWaitList, eventWaitList, event);
+    }
+
     void *srcPtr = const_cast<void *>(ptr);
 
     MemObjSurface dstImgSurf(dstImage);
@@ -64,9 +84,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
     if (mapAllocation) {
         surfaces[1] = &mapSurface;
         mapSurface.setGraphicsAllocation(mapAllocation);
-        // get offset between base cpu ptr of map allocation and dst ptr
-        size_t srcOffset = ptrDiff(srcPtr, mapAllocation->getUnderlyingBuffer());
-        srcPtr = reinterpret_cast<void *>(mapAllocation->getGpuAddress() + srcOffset);
+        srcPtr = convertAddressWithOffsetToGpuVa(srcPtr, memoryType, *mapAllocation);
     } else {
         surfaces[1] = &hostPtrSurf;
         if (region[0] != 0 &&
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
+#include "shared/source/execution_environment/execution_environment.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
 
@@ -26,6 +27,8 @@ cl_int CommandQueueHw<GfxFamily>::finish() {
         return CL_OUT_OF_RESOURCES;
     }
 
+    getDevice().getExecutionEnvironment()->drainPrintfOutput();
+
     return CL_SUCCESS;
 }
 } // namespace NEO
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/context/buffer_pool_size_class_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include "opencl/source/mem_obj/buffer.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+bool BufferPoolSizeClassCache::isEnabled() {
+    return debugManager.flags.ExperimentalSmallBufferPoolSizeClasses.get() == 1;
+}
+
+bool BufferPoolSizeClassCache::getSizeClassIndex(size_t size, uint32_t &sizeClassIndex) {
+    for (uint32_t i = 0; i < sizeClasses.size(); i++) {
+        if (size <= sizeClasses[i]) {
+            sizeClassIndex = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t BufferPoolSizeClassCache::getCurrentThreadStripe() {
+    static std::atomic<uint32_t> nextStripe{0};
+    thread_local uint32_t stripeIndex = nextStripe.fetch_add(1) % stripeCount;
+    return stripeIndex;
+}
+
+BufferPoolSlot *BufferPoolSizeClassCache::acquire(uint32_t sizeClassIndex, uint32_t stripeIndex, size_t requestedSize, MemoryManager &memoryManager) {
+    auto &stripe = this->stripes[stripeIndex];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    auto &freeSlots = stripe.freeSlots[sizeClassIndex];
+    if (freeSlots.empty()) {
+        this->collectReleasedSlots(stripe, memoryManager);
+        if (freeSlots.empty()) {
+            this->missCount++;
+            return nullptr;
+        }
+    }
+    auto slot = freeSlots.back();
+    freeSlots.pop_back();
+    slot->slab->slotsInUse++;
+    slot->requestedSize = requestedSize;
+    this->liveBytes += requestedSize;
+    this->hitCount++;
+    return slot;
+}
+
+BufferPoolSlot *BufferPoolSizeClassCache::addSlab(Buffer *poolStorage, HeapAllocator *chunkAllocator, uint64_t chunkAddress, size_t chunkOffset,
+                                                  uint32_t sizeClassIndex, uint32_t stripeIndex, size_t requestedSize) {
+    auto slab = std::make_unique<BufferPoolSlab>();
+    slab->poolStorage = poolStorage;
+    slab->chunkAllocator = chunkAllocator;
+    slab->chunkAddress = chunkAddress;
+    slab->sizeClassIndex = sizeClassIndex;
+    slab->stripeIndex = stripeIndex;
+
+    const auto slotSize = sizeClasses[sizeClassIndex];
+    slab->slots.resize(slabSize / slotSize);
+    for (size_t i = 0; i < slab->slots.size(); i++) {
+        slab->slots[i].slab = slab.get();
+        slab->slots[i].offset = chunkOffset + i * slotSize;
+    }
+
+    auto slot = &slab->slots[0];
+    slot->requestedSize = requestedSize;
+    slab->slotsInUse = 1u;
+
+    auto &stripe = this->stripes[stripeIndex];
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        auto &freeSlots = stripe.freeSlots[sizeClassIndex];
+        for (auto i = slab->slots.size() - 1; i > 0; i--) {
+            freeSlots.push_back(&slab->slots[i]);
+        }
+        stripe.slabs.push_back(std::move(slab));
+    }
+
+    this->liveBytes += requestedSize;
+    this->slabCount++;
+    this->slabsSinceTrim++;
+    return slot;
+}
+
+void BufferPoolSizeClassCache::release(BufferPoolSlot *slot) {
+    this->liveBytes -= slot->requestedSize;
+    auto &releasedSlots = this->stripes[slot->slab->stripeIndex].releasedSlots;
+    auto head = releasedSlots.load(std::memory_order_relaxed);
+    do {
+        slot->next = head;
+    } while (!releasedSlots.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void BufferPoolSizeClassCache::collectReleasedSlots(Stripe &stripe, MemoryManager &memoryManager) {
+    for (auto slot = stripe.releasedSlots.exchange(nullptr, std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+        stripe.pendingSlots.push_back(slot);
+    }
+
+    std::vector<std::pair<Buffer *, bool>> poolStorageIdle;
+    auto isPoolStorageIdle = [&](Buffer *poolStorage) {
+        for (auto &entry : poolStorageIdle) {
+            if (entry.first == poolStorage) {
+                return entry.second;
+            }
+        }
+        bool idle = true;
+        for (auto allocation : poolStorage->getMultiGraphicsAllocation().getGraphicsAllocations()) {
+            if (allocation && memoryManager.allocInUse(*allocation)) {
+                idle = false;
+                break;
+            }
+        }
+        poolStorageIdle.emplace_back(poolStorage, idle);
+        return idle;
+    };
+
+    auto &pendingSlots = stripe.pendingSlots;
+    pendingSlots.erase(std::remove_if(pendingSlots.begin(), pendingSlots.end(), [&](BufferPoolSlot *slot) {
+                           if (!isPoolStorageIdle(slot->slab->poolStorage)) {
+                               return false;
+                           }
+                           stripe.freeSlots[slot->slab->sizeClassIndex].push_back(slot);
+                           slot->slab->slotsInUse--;
+                           return true;
+                       }),
+                       pendingSlots.end());
+}
+
+bool BufferPoolSizeClassCache::isTrimDue() {
+    return this->slabsSinceTrim.load() >= trimInterval;
+}
+
+size_t BufferPoolSizeClassCache::trim(MemoryManager &memoryManager) {
+    size_t trimmedSlabs = 0;
+    for (auto &stripe : this->stripes) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        this->collectReleasedSlots(stripe, memoryManager);
+
+        auto &slabs = stripe.slabs;
+        for (auto it = slabs.begin(); it != slabs.end();) {
+            auto slab = it->get();
+            if (slab->slotsInUse > 0) {
+                ++it;
+                continue;
+            }
+            auto &freeSlots = stripe.freeSlots[slab->sizeClassIndex];
+            freeSlots.erase(std::remove_if(freeSlots.begin(), freeSlots.end(), [slab](BufferPoolSlot *slot) { return slot->slab == slab; }),
+                            freeSlots.end());
+            slab->chunkAllocator->free(slab->chunkAddress, slabSize);
+            it = slabs.erase(it);
+            trimmedSlabs++;
+        }
+    }
+    this->slabCount -= trimmedSlabs;
+    this->slabsSinceTrim = 0;
+    return trimmedSlabs;
+}
+
+double BufferPoolSizeClassCache::getHitRate() const {
+    auto hits = this->hitCount.load();
+    auto requests = hits + this->missCount.load();
+    return requests == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(requests);
+}
+
+uint32_t BufferPoolSizeClassCache::getFragmentationPercent() const {
+    const uint64_t slabBytes = this->slabCount.load() * slabSize;
+    if (slabBytes == 0) {
+        return 0u;
+    }
+    const uint64_t usedBytes = std::min(this->liveBytes.load(), slabBytes);
+    return static_cast<uint32_t>(100u - usedBytes * 100u / slabBytes);
+}
+
+} // namespace NEO
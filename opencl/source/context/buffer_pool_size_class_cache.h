@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Buffer;
+class HeapAllocator;
+class MemoryManager;
+struct BufferPoolSlab;
+
+// Fixed size slot carved out of a slab. Slots live as long as the cache owning their slab, so a released slot
+// can be pushed back onto its stripe without taking any lock.
+struct BufferPoolSlot {
+    BufferPoolSlab *slab = nullptr;
+    BufferPoolSlot *next = nullptr;
+    size_t offset = 0;
+    size_t requestedSize = 0;
+};
+
+// One pool chunk dedicated to a single size class. Owned by the stripe it was reserved for.
+struct BufferPoolSlab {
+    Buffer *poolStorage = nullptr;
+    HeapAllocator *chunkAllocator = nullptr;
+    uint64_t chunkAddress = 0;
+    uint32_t sizeClassIndex = 0;
+    uint32_t stripeIndex = 0;
+    uint32_t slotsInUse = 0;
+    std::vector<BufferPoolSlot> slots;
+};
+
+// Size class front end of the small buffer pool. Sub-4KB requests are rounded up to a size class and served
+// from slabs reserved out of the pools. Slabs are spread over stripes, each thread sticks to one stripe, so
+// concurrent allocations rarely meet on the same lock. Releasing a buffer is a lock-free push onto the stripe
+// owning its slot; released slots become reusable once the GPU is done with the pool storage.
+class BufferPoolSizeClassCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr std::array<size_t, 3> sizeClasses = {1 * MemoryConstants::kiloByte, 2 * MemoryConstants::kiloByte, 4 * MemoryConstants::kiloByte};
+    static constexpr size_t slabSize = MemoryConstants::pageSize64k;
+    static constexpr uint32_t stripeCount = 8u;
+    static constexpr uint32_t trimInterval = 64u;
+
+    static bool isEnabled();
+    static bool getSizeClassIndex(size_t size, uint32_t &sizeClassIndex);
+    static uint32_t getCurrentThreadStripe();
+
+    BufferPoolSlot *acquire(uint32_t sizeClassIndex, uint32_t stripeIndex, size_t requestedSize, MemoryManager &memoryManager);
+    BufferPoolSlot *addSlab(Buffer *poolStorage, HeapAllocator *chunkAllocator, uint64_t chunkAddress, size_t chunkOffset,
+                            uint32_t sizeClassIndex, uint32_t stripeIndex, size_t requestedSize);
+    void release(BufferPoolSlot *slot);
+    bool isTrimDue();
+    size_t trim(MemoryManager &memoryManager);
+
+    uint64_t getHitCount() const { return hitCount.load(); }
+    uint64_t getMissCount() const { return missCount.load(); }
+    double getHitRate() const;
+    uint32_t getFragmentationPercent() const;
+    size_t getSlabCount() const { return slabCount.load(); }
+
+  protected:
+    struct Stripe {
+        std::mutex mutex;
+        std::array<std::vector<BufferPoolSlot *>, sizeClasses.size()> freeSlots;
+        std::vector<BufferPoolSlot *> pendingSlots;
+        std::vector<std::unique_ptr<BufferPoolSlab>> slabs;
+        std::atomic<BufferPoolSlot *> releasedSlots{nullptr};
+    };
+
+    void collectReleasedSlots(Stripe &stripe, MemoryManager &memoryManager);
+
+    std::array<Stripe, stripeCount> stripes;
+    std::atomic<uint64_t> hitCount{0};
+    std::atomic<uint64_t> missCount{0};
+    std::atomic<uint64_t> liveBytes{0};
+    std::atomic<size_t> slabCount{0};
+    std::atomic<uint32_t> slabsSinceTrim{0};
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,17 +15,20 @@
 #include "shared/source/device/sub_device.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/api_specific_config.h"
+#include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/utilities/buffer_pool_allocator.inl"
 #include "shared/source/utilities/heap_allocator.h"
 #include "shared/source/utilities/staging_buffer_manager.h"
 #include "shared/source/utilities/tag_allocator.h"
 
+#include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/execution_environment/cl_execution_environment.h"
@@ -57,6 +60,10 @@ Context::Context(
 Context::~Context() {
     gtpinNotifyContextDestroy((cl_context)this);
 
+    if (builtinsWarmUpThread) {
+        builtinsWarmUpThread->join();
+    }
+
     if (multiRootDeviceTimestampPacketAllocator.get() != nullptr) {
         multiRootDeviceTimestampPacketAllocator.reset();
     }
@@ -67,6 +74,10 @@ Context::~Context() {
 
     cleanupUsmAllocationPools();
 
+    if (memoryManager) {
+        mapAllocationPool.releaseAll(*memoryManager);
+    }
+
     delete[] properties;
 
     for (auto rootDeviceIndex = 0u; rootDeviceIndex < specialQueues.size(); rootDeviceIndex++) {
@@ -308,11 +319,32 @@ bool Context::createImpl(const cl_context_properties *properties,
             this->svmAllocsManager->initUsmAllocationsCaches(device->getDevice());
             this->stagingBufferManager = std::make_unique<StagingBufferManager>(svmAllocsManager, rootDeviceIndices, deviceBitfields);
         }
+
+        if (debugManager.flags.EnableBuiltinsWarmUp.get() == 1) {
+            this->builtinsWarmUpThread = Thread::createFunc(warmUpBuiltins, reinterpret_cast<void *>(this));
+        }
     }
 
     return true;
 }
 
+void *Context::warmUpBuiltins(void *arg) {
+    auto context = reinterpret_cast<Context *>(arg);
+    for (auto &device : context->devices) {
+        auto &compilerProductHelper = device->getRootDeviceEnvironment().getHelper<CompilerProductHelper>();
+        const bool useStateless = compilerProductHelper.isForceToStatelessRequired();
+        const bool useHeapless = compilerProductHelper.isHeaplessModeEnabled();
+
+        // builders are created once per root device, so later enqueues only wait for the build in progress
+        for (auto builtInType : {EBuiltInOps::adjustBuiltinType<EBuiltInOps::copyBufferToBuffer>(useStateless, useHeapless),
+                                 EBuiltInOps::adjustBuiltinType<EBuiltInOps::fillBuffer>(useStateless, useHeapless),
+                                 EBuiltInOps::adjustBuiltinType<EBuiltInOps::copyBufferRect>(useStateless, useHeapless)}) {
+            BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(builtInType, *device);
+        }
+    }
+    return nullptr;
+}
+
 cl_int Context::getInfo(cl_context_info paramName, size_t paramValueSize,
                         void *paramValue, size_t *paramValueSizeRet) {
     cl_int retVal;
@@ -648,6 +680,14 @@ Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryPropert
         return nullptr;
     }
 
+    uint32_t sizeClassIndex = 0;
+    if (BufferPoolSizeClassCache::isEnabled() && BufferPoolSizeClassCache::getSizeClassIndex(requestedSize, sizeClassIndex)) {
+        auto bufferFromCache = this->allocateFromSizeClassCache(flags, flagsIntel, requestedSize, sizeClassIndex, errcodeRet);
+        if (bufferFromCache != nullptr) {
+            return bufferFromCache;
+        }
+    }
+
     auto lock = std::unique_lock<std::mutex>(mutex);
     auto bufferFromPool = this->allocateFromPools(memoryProperties, flags, flagsIntel, requestedSize, hostPtr, errcodeRet);
     if (bufferFromPool != nullptr) {
@@ -685,6 +725,80 @@ Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &
     return nullptr;
 }
 
+Buffer *Context::BufferPoolAllocator::allocateFromSizeClassCache(cl_mem_flags flags,
+                                                                 cl_mem_flags_intel flagsIntel,
+                                                                 size_t requestedSize,
+                                                                 uint32_t sizeClassIndex,
+                                                                 cl_int &errcodeRet) {
+    const auto stripeIndex = BufferPoolSizeClassCache::getCurrentThreadStripe();
+    auto slot = this->sizeClassCache.acquire(sizeClassIndex, stripeIndex, requestedSize, *this->context->getMemoryManager());
+    if (slot == nullptr) {
+        slot = this->reserveSlab(sizeClassIndex, stripeIndex, requestedSize);
+        if (slot == nullptr) {
+            return nullptr;
+        }
+    }
+
+    cl_buffer_region bufferRegion{};
+    bufferRegion.origin = slot->offset;
+    bufferRegion.size = requestedSize;
+    auto poolStorage = slot->slab->poolStorage;
+    auto bufferFromPool = poolStorage->createSubBuffer(flags, flagsIntel, &bufferRegion, errcodeRet);
+    bufferFromPool->createFunction = poolStorage->createFunction;
+    bufferFromPool->setSizeInPoolAllocator(BufferPoolSizeClassCache::sizeClasses[sizeClassIndex]);
+    bufferFromPool->setBufferPoolSlot(slot);
+    return bufferFromPool;
+}
+
+BufferPoolSlot *Context::BufferPoolAllocator::reserveSlab(uint32_t sizeClassIndex, uint32_t stripeIndex, size_t requestedSize) {
+    auto lock = std::unique_lock<std::mutex>(mutex);
+    if (this->sizeClassCache.isTrimDue()) {
+        this->trimSizeClassCache();
+    }
+
+    auto slot = this->reserveSlabFromPools(sizeClassIndex, stripeIndex, requestedSize);
+    if (slot != nullptr) {
+        return slot;
+    }
+
+    this->drain();
+    this->trimSizeClassCache();
+
+    slot = this->reserveSlabFromPools(sizeClassIndex, stripeIndex, requestedSize);
+    if (slot != nullptr) {
+        return slot;
+    }
+
+    if (this->bufferPools.size() < this->maxPoolCount) {
+        this->addNewBufferPool(BufferPool{this->context});
+        return this->reserveSlabFromPools(sizeClassIndex, stripeIndex, requestedSize);
+    }
+    return nullptr;
+}
+
+BufferPoolSlot *Context::BufferPoolAllocator::reserveSlabFromPools(uint32_t sizeClassIndex, uint32_t stripeIndex, size_t requestedSize) {
+    for (auto &bufferPool : this->bufferPools) {
+        size_t chunkSize = BufferPoolSizeClassCache::slabSize;
+        auto chunkAddress = bufferPool.chunkAllocator->allocate(chunkSize);
+        if (chunkAddress != 0) {
+            return this->sizeClassCache.addSlab(bufferPool.mainStorage.get(), bufferPool.chunkAllocator.get(), chunkAddress,
+                                                static_cast<size_t>(chunkAddress - BufferPool::startingOffset), sizeClassIndex, stripeIndex, requestedSize);
+        }
+    }
+    return nullptr;
+}
+
+void Context::BufferPoolAllocator::trimSizeClassCache() {
+    auto trimmedSlabs = this->sizeClassCache.trim(*this->context->getMemoryManager());
+    if (this->context->isProvidingPerformanceHints()) {
+        this->context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_NEUTRAL_INTEL, BUFFER_POOL_SIZE_CLASS_STATISTICS,
+                                              static_cast<uint32_t>(this->sizeClassCache.getHitRate() * 100.0),
+                                              this->sizeClassCache.getFragmentationPercent(),
+                                              static_cast<uint32_t>(this->sizeClassCache.getSlabCount()),
+                                              static_cast<uint32_t>(trimmedSlabs));
+    }
+}
+
 TagAllocatorBase *Context::getMultiRootDeviceTimestampPacketAllocator() {
     return multiRootDeviceTimestampPacketAllocator.get();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/cl_device/cl_device_vector.h"
+#include "opencl/source/context/buffer_pool_size_class_cache.h"
 #include "opencl/source/context/context_type.h"
 #include "opencl/source/context/driver_diagnostics.h"
 #include "opencl/source/gtpin/gtpin_notify.h"
@@ -41,6 +42,7 @@ class Program;
 class Platform;
 class TagAllocatorBase;
 class StagingBufferManager;
+class Thread;
 
 template <>
 struct OpenCLObjectMapper<_cl_context> {
@@ -79,6 +81,8 @@ class Context : public BaseObject<_cl_context> {
                                        void *hostPtr,
                                        cl_int &errcodeRet);
         bool flagsAllowBufferFromPool(const cl_mem_flags &flags, const cl_mem_flags_intel &flagsIntel) const;
+        void releaseBufferPoolSlot(BufferPoolSlot *slot) { this->sizeClassCache.release(slot); }
+        const BufferPoolSizeClassCache &getSizeClassCache() const { return this->sizeClassCache; }
 
       protected:
         Buffer *allocateFromPools(const MemoryProperties &memoryProperties,
@@ -87,11 +91,20 @@ class Context : public BaseObject<_cl_context> {
                                   size_t requestedSize,
                                   void *hostPtr,
                                   cl_int &errcodeRet);
+        Buffer *allocateFromSizeClassCache(cl_mem_flags flags,
+                                           cl_mem_flags_intel flagsIntel,
+                                           size_t requestedSize,
+                                           uint32_t sizeClassIndex,
+                                           cl_int &errcodeRet);
+        BufferPoolSlot *reserveSlab(uint32_t sizeClassIndex, uint32_t stripeIndex, size_t requestedSize);
+        BufferPoolSlot *reserveSlabFromPools(uint32_t sizeClassIndex, uint32_t stripeIndex, size_t requestedSize);
+        void trimSizeClassCache();
         static inline size_t calculateMaxPoolCount(uint64_t totalMemory, size_t percentOfMemory) {
             const auto maxPoolCount = static_cast<size_t>(totalMemory * (percentOfMemory / 100.0) / BufferPoolAllocator::aggregatedSmallBuffersPoolSize);
             return maxPoolCount ? maxPoolCount : 1u;
         }
 
+        BufferPoolSizeClassCache sizeClassCache;
         Context *context{nullptr};
         size_t maxPoolCount{1u};
     };
@@ -152,6 +165,7 @@ class Context : public BaseObject<_cl_context> {
     }
 
     auto &getMapOperationsStorage() { return mapOperationsStorage; }
+    MapAllocationPool &getMapAllocationPool() { return mapAllocationPool; }
 
     cl_int tryGetExistingHostPtrAllocation(const void *ptr,
                                            size_t size,
@@ -276,6 +290,7 @@ class Context : public BaseObject<_cl_context> {
     void *getOsContextInfo(cl_context_info &paramName, size_t *srcParamSize);
 
     void setupContextType();
+    static void *warmUpBuiltins(void *arg);
 
     RootDeviceIndicesContainer rootDeviceIndices;
     std::map<uint32_t, DeviceBitfield> deviceBitfields;
@@ -290,6 +305,7 @@ class Context : public BaseObject<_cl_context> {
     MemoryManager *memoryManager = nullptr;
     SVMAllocsManager *svmAllocsManager = nullptr;
     MapOperationsStorage mapOperationsStorage = {};
+    MapAllocationPool mapAllocationPool;
     StackVec<CommandQueue *, 1> specialQueues;
     DriverDiagnostics *driverDiagnostics = nullptr;
     BufferPoolAllocator smallBufferPoolAllocator;
@@ -303,6 +319,7 @@ class Context : public BaseObject<_cl_context> {
     std::mutex multiRootDeviceAllocatorMtx;
 
     std::unique_ptr<StagingBufferManager> stagingBufferManager;
+    std::unique_ptr<Thread> builtinsWarmUpThread;
 
     bool interopUserSync = false;
     bool resolvesRequiredInKernels = false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -61,7 +61,8 @@ const char *const DriverDiagnostics::hintFormat[] = {
     "Performance hint: Buffer %p will use compressed memory.",                                                                                                                                                                            // BUFFER_IS_COMPRESSED
     "Performance hint: Buffer %p will not use compressed memory.",                                                                                                                                                                        // BUFFER_IS_NOT_COMPRESSED
     "Performance hint: Image %p will use compressed memory.",                                                                                                                                                                             // IMAGE_IS_COMPRESSED
-    "Performance hint: Image %p will not use compressed memory."};                                                                                                                                                                        // IMAGE_IS_NOT_COMPRESSED
+    "Performance hint: Image %p will not use compressed memory.",                                                                                                                                                                         // IMAGE_IS_NOT_COMPRESSED
+    "Performance hint: Small buffer pool served %u%% of allocations from size class caches, %u%% of slab memory is unused, %u slabs reserved, %u empty slabs trimmed."};                                                                  // BUFFER_POOL_SIZE_CLASS_STATISTICS
 
 PerformanceHints DriverDiagnostics::obtainHintForTransferOperation(cl_command_type commandType, bool transferRequired) {
     PerformanceHints hint;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,7 +52,8 @@ enum PerformanceHints {
     BUFFER_IS_COMPRESSED,
     BUFFER_IS_NOT_COMPRESSED,
     IMAGE_IS_COMPRESSED,
-    IMAGE_IS_NOT_COMPRESSED
+    IMAGE_IS_NOT_COMPRESSED,
+    BUFFER_POOL_SIZE_CLASS_STATISTICS
 };
 
 class DriverDiagnostics {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,15 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace NEO {
@@ -21,6 +24,7 @@ AsyncEventsHandler::AsyncEventsHandler() {
     registerList.reserve(64);
     list.reserve(64);
     pendingList.reserve(64);
+    completedBatch.reserve(64);
 }
 
 AsyncEventsHandler::~AsyncEventsHandler() {
@@ -37,25 +41,91 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+bool AsyncEventsHandler::isProcessingNeeded(Event *event) {
+    return event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE));
+}
+
+bool AsyncEventsHandler::indexEvent(Event *event) {
+    auto cmdQueue = event->getCommandQueue();
+    auto taskCount = event->peekTaskCount();
+    if (cmdQueue == nullptr || event->isExternallySynchronized() || event->peekIsBlocked() || taskCount == CompletionStamp::notReady) {
+        return false;
+    }
+
+    auto csr = &cmdQueue->getGpgpuCommandStreamReceiver();
+    if (csr->testTaskCountReady(csr->getTagAddress(), taskCount)) {
+        // gpgpu work is done, completion depends on other engines
+        return false;
+    }
+
+    auto completionQueue = std::find_if(completionQueues.begin(), completionQueues.end(), [csr](const CompletionQueue &queue) { return queue.csr == csr; });
+    if (completionQueue == completionQueues.end()) {
+        completionQueue = completionQueues.insert(completionQueues.end(), CompletionQueue{csr, {}});
+    }
+    completionQueue->heap.push_back({taskCount, event});
+    std::push_heap(completionQueue->heap.begin(), completionQueue->heap.end(), PendingEventGreater{});
+    return true;
+}
+
+void AsyncEventsHandler::collectCompletedEvents(CompletionQueue &completionQueue) {
+    auto &heap = completionQueue.heap;
+    auto csr = completionQueue.csr;
+    completedBatch.clear();
+
+    while (!heap.empty()) {
+        auto &earliest = heap.front();
+        if (isProcessingNeeded(earliest.event) && !csr->testTaskCountReady(csr->getTagAddress(), earliest.taskCount)) {
+            break;
+        }
+        completedBatch.push_back(earliest.event);
+        std::pop_heap(heap.begin(), heap.end(), PendingEventGreater{});
+        heap.pop_back();
+    }
+
+    for (auto event : completedBatch) {
+        event->updateExecutionStatus();
+        if (isProcessingNeeded(event)) {
+            list.push_back(event);
+        } else {
+            event->decRefInternal();
+        }
+    }
+}
+
 Event *AsyncEventsHandler::processList() {
-    TaskCountType lowestTaskCount = CompletionStamp::notReady;
-    Event *sleepCandidate = nullptr;
     pendingList.clear();
 
     for (auto event : list) {
         event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
-            pendingList.push_back(event);
-            if (event->peekTaskCount() < lowestTaskCount) {
-                sleepCandidate = event;
-                lowestTaskCount = event->peekTaskCount();
-            }
-        } else {
+        if (!isProcessingNeeded(event)) {
             event->decRefInternal();
+        } else if (!indexEvent(event)) {
+            pendingList.push_back(event);
         }
     }
-
     list.swap(pendingList);
+
+    for (auto &completionQueue : completionQueues) {
+        collectCompletedEvents(completionQueue);
+    }
+    completionQueues.erase(std::remove_if(completionQueues.begin(), completionQueues.end(), [](const CompletionQueue &queue) { return queue.heap.empty(); }),
+                           completionQueues.end());
+
+    TaskCountType lowestTaskCount = CompletionStamp::notReady;
+    Event *sleepCandidate = nullptr;
+    for (auto &completionQueue : completionQueues) {
+        auto &earliest = completionQueue.heap.front();
+        if (earliest.taskCount < lowestTaskCount) {
+            sleepCandidate = earliest.event;
+            lowestTaskCount = earliest.taskCount;
+        }
+    }
+    for (auto event : list) {
+        if (event->peekTaskCount() < lowestTaskCount) {
+            sleepCandidate = event;
+            lowestTaskCount = event->peekTaskCount();
+        }
+    }
     return sleepCandidate;
 }
 
@@ -73,7 +143,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (!self->hasPendingEvents()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -119,6 +189,12 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &completionQueue : completionQueues) {
+        for (auto &pendingEvent : completionQueue.heap) {
+            pendingEvent.event->decRefInternal();
+        }
+    }
+    completionQueues.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
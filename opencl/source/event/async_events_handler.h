@@ -1,11 +1,13 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+
 #include <atomic>
 #include <condition_variable>
 #include <memory>
@@ -13,6 +15,7 @@
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -24,14 +27,35 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    struct PendingEvent {
+        TaskCountType taskCount;
+        Event *event;
+    };
+    struct PendingEventGreater {
+        bool operator()(const PendingEvent &lhs, const PendingEvent &rhs) const { return lhs.taskCount > rhs.taskCount; }
+    };
+    // submitted events of a single CSR, min-heap ordered by task count
+    struct CompletionQueue {
+        CommandStreamReceiver *csr;
+        std::vector<PendingEvent> heap;
+    };
+
     Event *processList();
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
     MOCKABLE_VIRTUAL void transferRegisterList();
+    static bool isProcessingNeeded(Event *event);
+    bool indexEvent(Event *event);
+    void collectCompletedEvents(CompletionQueue &completionQueue);
+    bool hasPendingEvents() const { return !list.empty() || !completionQueues.empty(); }
+
     std::vector<Event *> registerList;
+    // events which cannot be indexed by task count yet (blocked, externally synchronized or without command queue)
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    std::vector<Event *> completedBatch;
+    std::vector<CompletionQueue> completionQueues;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,8 @@ struct TransferProperties {
     cl_map_flags mapFlags = 0;
     uint32_t mipLevel = 0;
     uint32_t mipPtrOffset = 0;
+    size_t hostRowPitch = 0;
+    size_t hostSlicePitch = 0;
     bool blocking = false;
     bool doTransferOnCpu = false;
     bool finishRequired = false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,7 @@
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/sampler_helpers.h"
 #include "opencl/source/kernel/kernel_info_cl.h"
+#include "opencl/source/kernel/kernel_prototype.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/mem_obj/pipe.h"
@@ -185,7 +186,6 @@ cl_int Kernel::initialize() {
     auto &gfxCoreHelper = rootDeviceEnvironment.getHelper<GfxCoreHelper>();
     auto &productHelper = rootDeviceEnvironment.getHelper<ProductHelper>();
     auto &kernelDescriptor = kernelInfo.kernelDescriptor;
-    const auto &implicitArgs = kernelDescriptor.payloadMappings.implicitArgs;
     const auto &explicitArgs = kernelDescriptor.payloadMappings.explicitArgs;
     auto maxSimdSize = kernelInfo.getMaxSimdSize();
     const auto &heapInfo = kernelInfo.heapInfo;
@@ -229,17 +229,7 @@ cl_int Kernel::initialize() {
             memset(crossThreadData, 0x00, crossThreadDataSize);
         }
 
-        auto crossThread = reinterpret_cast<uint32_t *>(crossThreadData);
-        auto setArgsIfValidOffset = [&](uint32_t *&crossThreadData, NEO::CrossThreadDataOffset offset, uint32_t value) {
-            if (isValidOffset(offset)) {
-                crossThreadData = ptrOffset(crossThread, offset);
-                *crossThreadData = value;
-            }
-        };
-        setArgsIfValidOffset(maxWorkGroupSizeForCrossThreadData, implicitArgs.maxWorkGroupSize, maxKernelWorkGroupSize);
-        setArgsIfValidOffset(dataParameterSimdSize, implicitArgs.simdSize, maxSimdSize);
-        setArgsIfValidOffset(preferredWkgMultipleOffset, implicitArgs.preferredWkgMultiple, maxSimdSize);
-        setArgsIfValidOffset(parentEventOffset, implicitArgs.deviceSideEnqueueParentEvent, undefined<uint32_t>);
+        patchImplicitArgsInCrossThreadData();
     }
 
     // allocate our own SSH, if necessary
@@ -381,6 +371,122 @@ cl_int Kernel::initialize() {
     return CL_SUCCESS;
 }
 
+void Kernel::patchImplicitArgsInCrossThreadData() {
+    const auto &implicitArgs = kernelInfo.kernelDescriptor.payloadMappings.implicitArgs;
+    auto maxSimdSize = kernelInfo.getMaxSimdSize();
+
+    auto crossThread = reinterpret_cast<uint32_t *>(crossThreadData);
+    auto setArgsIfValidOffset = [&](uint32_t *&crossThreadData, NEO::CrossThreadDataOffset offset, uint32_t value) {
+        if (isValidOffset(offset)) {
+            crossThreadData = ptrOffset(crossThread, offset);
+            *crossThreadData = value;
+        }
+    };
+    setArgsIfValidOffset(maxWorkGroupSizeForCrossThreadData, implicitArgs.maxWorkGroupSize, maxKernelWorkGroupSize);
+    setArgsIfValidOffset(dataParameterSimdSize, implicitArgs.simdSize, maxSimdSize);
+    setArgsIfValidOffset(preferredWkgMultipleOffset, implicitArgs.preferredWkgMultiple, maxSimdSize);
+    setArgsIfValidOffset(parentEventOffset, implicitArgs.deviceSideEnqueueParentEvent, undefined<uint32_t>);
+}
+
+cl_int Kernel::initializeWithPrototype() {
+    if (!KernelPrototype::isEnabled()) {
+        return initialize();
+    }
+
+    auto prototype = program->getKernelPrototype(kernelInfo, clDevice);
+    if (prototype) {
+        return initializeFromPrototype(*prototype);
+    }
+
+    auto status = initialize();
+    if (status == CL_SUCCESS) {
+        program->addKernelPrototype(kernelInfo, clDevice, createPrototype());
+    }
+    return status;
+}
+
+std::unique_ptr<KernelPrototype> Kernel::createPrototype() const {
+    auto prototype = std::make_unique<KernelPrototype>();
+    prototype->kernelArguments = kernelArguments;
+    prototype->kernelArgHandlers = kernelArgHandlers;
+
+    prototype->crossThreadDataSize = crossThreadDataSize;
+    if (crossThreadDataSize) {
+        prototype->crossThreadData = std::make_unique<char[]>(crossThreadDataSize);
+        memcpy_s(prototype->crossThreadData.get(), crossThreadDataSize, crossThreadData, crossThreadDataSize);
+    }
+    prototype->sshLocalSize = sshLocalSize;
+    if (sshLocalSize) {
+        prototype->sshLocal = std::make_unique<char[]>(sshLocalSize);
+        memcpy_s(prototype->sshLocal.get(), sshLocalSize, pSshLocal.get(), sshLocalSize);
+    }
+    if (pImplicitArgs) {
+        prototype->implicitArgs = std::make_unique<ImplicitArgs>(*pImplicitArgs);
+    }
+
+    prototype->maxKernelWorkGroupSize = maxKernelWorkGroupSize;
+    prototype->allBufferArgsStateful = allBufferArgsStateful;
+    prototype->containsStatelessWrites = containsStatelessWrites;
+    prototype->systolicPipelineSelectMode = systolicPipelineSelectMode;
+    prototype->usingImages = usingImages;
+    prototype->usingImagesOnly = usingImagesOnly;
+    prototype->auxTranslationRequired = auxTranslationRequired;
+    prototype->kernelHasIndirectAccess = kernelHasIndirectAccess;
+    return prototype;
+}
+
+cl_int Kernel::initializeFromPrototype(const KernelPrototype &prototype) {
+    auto &kernelDescriptor = kernelInfo.kernelDescriptor;
+
+    maxKernelWorkGroupSize = prototype.maxKernelWorkGroupSize;
+    containsStatelessWrites = prototype.containsStatelessWrites;
+    systolicPipelineSelectMode = prototype.systolicPipelineSelectMode;
+
+    if (prototype.implicitArgs) {
+        pImplicitArgs = std::make_unique<ImplicitArgs>(*prototype.implicitArgs);
+    }
+
+    // cross-thread data and ssh already contain implicit args and program surfaces patched at prototype creation
+    crossThreadDataSize = prototype.crossThreadDataSize;
+    if (crossThreadDataSize) {
+        crossThreadData = new char[crossThreadDataSize];
+        memcpy_s(crossThreadData, crossThreadDataSize, prototype.crossThreadData.get(), crossThreadDataSize);
+        patchImplicitArgsInCrossThreadData();
+    }
+    sshLocalSize = prototype.sshLocalSize;
+    if (sshLocalSize) {
+        pSshLocal = std::make_unique<char[]>(sshLocalSize);
+        memcpy_s(pSshLocal.get(), sshLocalSize, prototype.sshLocal.get(), sshLocalSize);
+    }
+
+    numberOfBindingTableStates = kernelDescriptor.payloadMappings.bindingTable.numEntries;
+    localBindingTableOffset = kernelDescriptor.payloadMappings.bindingTable.tableOffset;
+
+    // private surface is owned by the kernel, patching it overwrites the address captured in the prototype
+    auto status = patchPrivateSurface();
+    if (CL_SUCCESS != status) {
+        return status;
+    }
+
+    auxTranslationRequired = prototype.auxTranslationRequired;
+    kernelHasIndirectAccess = prototype.kernelHasIndirectAccess;
+    allBufferArgsStateful = prototype.allBufferArgsStateful;
+    usingImages = prototype.usingImages;
+    usingImagesOnly = prototype.usingImagesOnly;
+
+    slmSizes.resize(prototype.kernelArguments.size());
+    kernelArguments = prototype.kernelArguments;
+    kernelArgHandlers = prototype.kernelArgHandlers;
+
+    provideInitializationHints();
+
+    if (kernelDescriptor.kernelAttributes.numLocalIdChannels > 0) {
+        initializeLocalIdsCache();
+    }
+
+    return CL_SUCCESS;
+}
+
 cl_int Kernel::patchPrivateSurface() {
     auto pClDevice = &getDevice();
     auto rootDeviceIndex = pClDevice->getRootDeviceIndex();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,7 @@ class Surface;
 class PrintfHandler;
 class MultiDeviceKernel;
 class LocalIdsCache;
+struct KernelPrototype;
 
 class Kernel : public ReferenceTrackedObject<Kernel> {
   public:
@@ -95,7 +96,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         KernelType *pKernel = nullptr;
 
         pKernel = new KernelType(program, kernelInfo, clDevice);
-        retVal = pKernel->initialize();
+        retVal = pKernel->initializeWithPrototype();
 
         if (retVal != CL_SUCCESS) {
             delete pKernel;
@@ -138,6 +139,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     }
 
     cl_int initialize();
+    cl_int initializeWithPrototype();
 
     MOCKABLE_VIRTUAL cl_int cloneKernel(Kernel *pSourceKernel);
 
@@ -461,6 +463,10 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         return clDevice;
     }
     cl_int patchPrivateSurface();
+    void patchImplicitArgsInCrossThreadData();
+
+    std::unique_ptr<KernelPrototype> createPrototype() const;
+    cl_int initializeFromPrototype(const KernelPrototype &prototype);
 
     bool hasTunningFinished(KernelSubmissionData &submissionData);
     bool hasRunFinished(TimestampPacketContainer *timestampContainer);
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/kernel/implicit_args_helper.h"
+
+#include "opencl/source/kernel/kernel.h"
+
+#include <memory>
+#include <vector>
+
+namespace NEO {
+
+// Per-kernel state derived from KernelInfo for a given device, captured right after the first Kernel::initialize.
+// Further kernels created from the same program and device copy it instead of re-deriving argument metadata,
+// cross-thread data and the surface state heap. Only the private surface is allocated and patched per kernel.
+struct KernelPrototype : NonCopyableOrMovableClass {
+    static bool isEnabled() {
+        return debugManager.flags.EnableKernelPrototypes.get() == 1;
+    }
+
+    std::vector<Kernel::SimpleKernelArgInfo> kernelArguments;
+    std::vector<Kernel::KernelArgHandler> kernelArgHandlers;
+    std::unique_ptr<char[]> crossThreadData;
+    std::unique_ptr<char[]> sshLocal;
+    std::unique_ptr<ImplicitArgs> implicitArgs;
+
+    uint32_t crossThreadDataSize = 0u;
+    uint32_t sshLocalSize = 0u;
+    uint32_t maxKernelWorkGroupSize = 0u;
+    uint32_t allBufferArgsStateful = CL_TRUE;
+
+    bool containsStatelessWrites = true;
+    bool systolicPipelineSelectMode = false;
+    bool usingImages = false;
+    bool usingImagesOnly = false;
+    bool auxTranslationRequired = false;
+    bool kernelHasIndirectAccess = true;
+};
+
+} // namespace NEO
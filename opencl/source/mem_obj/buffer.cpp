@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -804,6 +804,25 @@ bool Buffer::isReadWriteOnCpuPreferred(void *ptr, size_t size, const Device &dev
     return false;
 }
 
+bool Buffer::isReadOnlyMapOfLockedMemoryAllowed(const Device &device) {
+    if (debugManager.flags.EnableZeroCopyReadOnlyMap.get() != 1 || !allowCpuAccess() || forceDisallowCPUCopy) {
+        return false;
+    }
+
+    auto rootDeviceIndex = device.getRootDeviceIndex();
+    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    if (this->isCompressed(rootDeviceIndex) || !graphicsAllocation->isAllocatedInLocalMemoryPool() || graphicsAllocation->peekSharedHandle() != 0) {
+        return false;
+    }
+
+    if (device.getProductHelper().getLocalMemoryAccessMode(device.getHardwareInfo()) == LocalMemoryAccessMode::cpuAccessDisallowed) {
+        return false;
+    }
+
+    auto &osInterface = device.getRootDeviceEnvironment().osInterface;
+    return !osInterface || osInterface->isLockablePointer(graphicsAllocation->storageInfo.isLockable);
+}
+
 Buffer *Buffer::createBufferHw(Context *context,
                                const MemoryProperties &memoryProperties,
                                cl_mem_flags flags,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -953,6 +953,33 @@ void Image::transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray
                  copySize, copyOffset);
 }
 
+// Copies a region between a linear, CPU accessible image and a host pointer laid out with the given pitches
+// (0 means tightly packed, as in clEnqueueReadImage/clEnqueueWriteImage).
+void Image::copyRegionOnCpu(void *hostPtr, size_t hostRowPitch, size_t hostSlicePitch, const MemObjSizeArray &copySize, const MemObjOffsetArray &copyOffset, bool toImage) {
+    const bool is1dArray = imageDesc.image_type == CL_MEM_OBJECT_IMAGE1D_ARRAY;
+    const size_t lineWidth = copySize[0] * surfaceFormatInfo.surfaceFormat.imageElementSizeInBytes;
+    // For 1DArray type, array region is stored on 2nd position and there is a single row per slice.
+    const size_t rowCount = is1dArray ? 1u : copySize[1];
+    const size_t sliceCount = is1dArray ? copySize[1] : copySize[2];
+
+    hostRowPitch = hostRowPitch ? hostRowPitch : lineWidth;
+    hostSlicePitch = hostSlicePitch ? hostSlicePitch : rowCount * hostRowPitch;
+
+    auto imagePtr = ptrOffset(getCpuAddressForMemoryTransfer(), calculateOffsetForMapping(copyOffset));
+
+    for (size_t slice = 0; slice < sliceCount; slice++) {
+        for (size_t row = 0; row < rowCount; row++) {
+            auto imageRow = ptrOffset(imagePtr, slice * imageDesc.image_slice_pitch + row * imageDesc.image_row_pitch);
+            auto hostRow = ptrOffset(hostPtr, slice * hostSlicePitch + row * hostRowPitch);
+            if (toImage) {
+                memcpy_s(imageRow, lineWidth, hostRow, lineWidth);
+            } else {
+                memcpy_s(hostRow, lineWidth, imageRow, lineWidth);
+            }
+        }
+    }
+}
+
 cl_int Image::writeNV12Planes(const void *hostPtr, size_t hostPtrRowPitch, uint32_t rootDeviceIndex) {
     CommandQueue *cmdQ = context->getSpecialQueue(rootDeviceIndex);
     size_t origin[3] = {0, 0, 0};
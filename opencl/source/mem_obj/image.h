@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -149,6 +149,7 @@ class Image : public MemObj {
 
     void transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) override;
     void transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) override;
+    void copyRegionOnCpu(void *hostPtr, size_t hostRowPitch, size_t hostSlicePitch, const MemObjSizeArray &copySize, const MemObjOffsetArray &copyOffset, bool toImage);
 
     Image *redescribe();
     Image *redescribeFillImage();
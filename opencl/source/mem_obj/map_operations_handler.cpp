@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,11 @@
 
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
-#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <algorithm>
 
 using namespace NEO;
 
@@ -26,23 +30,27 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.emplace(reinterpret_cast<uintptr_t>(ptr), mapInfo);
+    maxMappedLength = std::max(maxMappedLength, ptrLength);
     return true;
 }
 
+MapOperationsHandler::MappedPointers::iterator MapOperationsHandler::firstCandidate(uintptr_t ptr) {
+    return mappedPointers.lower_bound(ptr - std::min(static_cast<uintptr_t>(maxMappedLength), ptr));
+}
+
 bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     if (inputMapInfo.readOnly) {
         return false;
     }
-    auto inputStartPtr = inputMapInfo.ptr;
-    auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
+    auto inputStartPtr = reinterpret_cast<uintptr_t>(inputMapInfo.ptr);
+    auto inputEndPtr = inputStartPtr + inputMapInfo.ptrLength;
 
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    for (auto it = firstCandidate(inputStartPtr); it != mappedPointers.end() && it->first <= inputEndPtr; it++) {
+        auto mappedEndPtr = it->first + it->second.ptrLength;
 
         // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
+        if (inputStartPtr < mappedEndPtr) {
             return true;
         }
     }
@@ -52,24 +60,23 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto it = mappedPointers.find(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (it == mappedPointers.end()) {
+        return false;
     }
-    return false;
+    outMapInfo = it->second;
+    return true;
 }
 
 bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        void *ptrStart = mapInfo.ptr;
-        void *ptrEnd = ptrOffset(mapInfo.ptr, mapInfo.ptrLength);
+    auto ptrStart = reinterpret_cast<uintptr_t>(ptr);
+    auto ptrEnd = ptrStart + size;
 
-        if (ptrStart <= ptr && ptrOffset(ptr, size) <= ptrEnd) {
-            outMapInfo = mapInfo;
+    for (auto it = firstCandidate(ptrStart); it != mappedPointers.end() && it->first <= ptrStart; it++) {
+        if (ptrEnd <= it->first + it->second.ptrLength) {
+            outMapInfo = it->second;
             return true;
         }
     }
@@ -79,13 +86,12 @@ bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size,
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
+    auto it = mappedPointers.find(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (it != mappedPointers.end()) {
+        mappedPointers.erase(it);
+    }
+    if (mappedPointers.empty()) {
+        maxMappedLength = 0;
     }
 }
 
@@ -119,3 +125,69 @@ void NEO::MapOperationsStorage::removeHandler(cl_mem memObj) {
     auto iterator = handlers.find(memObj);
     handlers.erase(iterator);
 }
+
+bool NEO::MapAllocationPool::isEnabled() {
+    return debugManager.flags.EnableMapAllocationPool.get() == 1;
+}
+
+size_t NEO::MapAllocationPool::getSizeClass(size_t size) {
+    if (size > maxSizeClass) {
+        return 0u;
+    }
+    size_t sizeClass = minSizeClass;
+    while (sizeClass < size) {
+        sizeClass <<= 1;
+    }
+    return sizeClass;
+}
+
+bool NEO::MapAllocationPool::acquire(uint32_t rootDeviceIndex, size_t size, Entry &outEntry) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto sizeClassEntries = entries.find(getSizeClass(size));
+    if (sizeClassEntries == entries.end()) {
+        return false;
+    }
+    auto &pooled = sizeClassEntries->second;
+    for (auto it = pooled.begin(); it != pooled.end(); it++) {
+        if (it->allocation->getRootDeviceIndex() == rootDeviceIndex) {
+            outEntry = *it;
+            pooled.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NEO::MapAllocationPool::release(const Entry &entry, size_t size) {
+    auto sizeClass = getSizeClass(size);
+    if (sizeClass == 0u) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &pooled = entries[sizeClass];
+    if (pooled.size() >= maxEntriesPerSizeClass) {
+        return false;
+    }
+    pooled.push_back(entry);
+    return true;
+}
+
+void NEO::MapAllocationPool::releaseAll(MemoryManager &memoryManager) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &sizeClassEntries : entries) {
+        for (auto &entry : sizeClassEntries.second) {
+            memoryManager.freeGraphicsMemory(entry.allocation);
+            memoryManager.freeSystemMemory(entry.memory);
+        }
+    }
+    entries.clear();
+}
+
+size_t NEO::MapAllocationPool::getPooledCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t count = 0u;
+    for (auto &sizeClassEntries : entries) {
+        count += sizeClassEntries.second.size();
+    }
+    return count;
+}
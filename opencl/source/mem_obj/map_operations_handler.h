@@ -1,18 +1,22 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
+
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <map>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
 
 namespace NEO {
+class MemoryManager;
 
 class MapOperationsHandler {
   public:
@@ -25,8 +29,15 @@ class MapOperationsHandler {
     size_t size() const;
 
   protected:
+    using MappedPointers = std::multimap<uintptr_t, MapInfo>;
+
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    MappedPointers::iterator firstCandidate(uintptr_t ptr);
+
+    // map regions ordered by start address; read-only regions may overlap, so lookups start maxMappedLength
+    // before the searched address instead of scanning all regions
+    MappedPointers mappedPointers;
+    size_t maxMappedLength = 0;
     mutable std::mutex mtx;
 };
 
@@ -44,4 +55,30 @@ class MapOperationsStorage {
     HandlersMap handlers{};
 };
 
+// Keeps the host memory and map allocations of released memory objects, grouped in power of two size classes,
+// so that mapping a new non zero-copy memory object does not allocate and register a new staging allocation.
+class MapAllocationPool {
+  public:
+    struct Entry {
+        void *memory = nullptr;
+        GraphicsAllocation *allocation = nullptr;
+    };
+
+    static constexpr size_t minSizeClass = MemoryConstants::pageSize;
+    static constexpr size_t maxSizeClass = 64 * MemoryConstants::megaByte;
+    static constexpr size_t maxEntriesPerSizeClass = 4u;
+
+    static bool isEnabled();
+    static size_t getSizeClass(size_t size);
+
+    bool acquire(uint32_t rootDeviceIndex, size_t size, Entry &outEntry);
+    bool release(const Entry &entry, size_t size);
+    void releaseAll(MemoryManager &memoryManager);
+    size_t getPooledCount();
+
+  protected:
+    std::mutex mutex;
+    std::unordered_map<size_t, std::vector<Entry>> entries;
+};
+
 } // namespace NEO
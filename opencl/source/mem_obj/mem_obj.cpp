@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,6 +78,9 @@ MemObj::~MemObj() {
         if (peekSharingHandler()) {
             peekSharingHandler()->releaseReusedGraphicsAllocation();
         }
+        if (isMapAllocationPooled) {
+            returnMapAllocationToPool();
+        }
 
         needWait |= multiGraphicsAllocation.getGraphicsAllocations().size() > 1u;
         for (auto graphicsAllocation : multiGraphicsAllocation.getGraphicsAllocations()) {
@@ -105,7 +108,11 @@ MemObj::~MemObj() {
         }
         if (associatedMemObject) {
             associatedMemObject->decRefInternal();
-            context->getBufferPoolAllocator().tryFreeFromPoolBuffer(associatedMemObject, this->offset, this->sizeInPoolAllocator);
+            if (bufferPoolSlot) {
+                context->getBufferPoolAllocator().releaseBufferPoolSlot(bufferPoolSlot);
+            } else {
+                context->getBufferPoolAllocator().tryFreeFromPoolBuffer(associatedMemObject, this->offset, this->sizeInPoolAllocator);
+            }
         }
         if (!associatedMemObject) {
             releaseAllocatedMapPtr();
@@ -394,13 +401,24 @@ void *MemObj::getBasePtrForMap(uint32_t rootDeviceIndex) {
             return getMapAllocation(rootDeviceIndex)->getUnderlyingBuffer();
         } else {
             auto memory = getAllocatedMapPtr();
+            auto mapAllocationSize = getSize();
+            if (!memory && isMapAllocationPoolable()) {
+                MapAllocationPool::Entry pooledEntry;
+                isMapAllocationPooled = true;
+                if (context->getMapAllocationPool().acquire(rootDeviceIndex, getSize(), pooledEntry)) {
+                    setAllocatedMapPtr(pooledEntry.memory);
+                    setMapAllocation(pooledEntry.allocation);
+                    return getAllocatedMapPtr();
+                }
+                mapAllocationSize = MapAllocationPool::getSizeClass(getSize());
+            }
             if (!memory) {
-                memory = memoryManager->allocateSystemMemory(getSize(), MemoryConstants::pageSize);
+                memory = memoryManager->allocateSystemMemory(mapAllocationSize, MemoryConstants::pageSize);
                 setAllocatedMapPtr(memory);
             }
             AllocationProperties properties{rootDeviceIndex,
                                             false, // allocateMemory
-                                            getSize(), AllocationType::mapAllocation,
+                                            mapAllocationSize, AllocationType::mapAllocation,
                                             false, // isMultiStorageAllocation
                                             context->getDeviceBitfieldForAllocation(rootDeviceIndex)};
 
@@ -411,6 +429,26 @@ void *MemObj::getBasePtrForMap(uint32_t rootDeviceIndex) {
     }
 }
 
+bool MemObj::isMapAllocationPoolable() const {
+    return MapAllocationPool::isEnabled() && !associatedMemObject && multiGraphicsAllocation.getGraphicsAllocations().size() == 1u &&
+           MapAllocationPool::getSizeClass(getSize()) != 0u;
+}
+
+void MemObj::returnMapAllocationToPool() {
+    auto rootDeviceIndex = multiGraphicsAllocation.getDefaultGraphicsAllocation()->getRootDeviceIndex();
+    MapAllocationPool::Entry entry{allocatedMapPtr, mapAllocations.getGraphicsAllocation(rootDeviceIndex)};
+    if (entry.memory == nullptr || entry.allocation == nullptr) {
+        return;
+    }
+    if (entry.allocation->isUsed()) {
+        memoryManager->waitForEnginesCompletion(*entry.allocation);
+    }
+    if (context->getMapAllocationPool().release(entry, getSize())) {
+        mapAllocations.removeAllocation(rootDeviceIndex);
+        allocatedMapPtr = nullptr;
+    }
+}
+
 MapOperationsHandler &MemObj::getMapOperationsHandler() {
     return context->getMapOperationsStorage().getHandler(this);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
 #include <vector>
 
 namespace NEO {
+struct BufferPoolSlot;
 class SharingHandler;
 struct MapInfo;
 class MapOperationsHandler;
@@ -167,11 +168,16 @@ class MemObj : public BaseObject<_cl_mem> {
     void setSizeInPoolAllocator(size_t size) {
         this->sizeInPoolAllocator = size;
     }
+    void setBufferPoolSlot(BufferPoolSlot *slot) {
+        this->bufferPoolSlot = slot;
+    }
 
   protected:
     void getOsSpecificMemObjectInfo(const cl_mem_info &paramName, size_t *srcParamSize, void **srcParam);
     void storeProperties(const cl_mem_properties *properties);
     void checkUsageAndReleaseOldAllocation(uint32_t rootDeviceIndex);
+    bool isMapAllocationPoolable() const;
+    void returnMapAllocationToPool();
 
     Context *context;
     cl_mem_object_type memObjectType;
@@ -180,6 +186,7 @@ class MemObj : public BaseObject<_cl_mem> {
     cl_mem_flags_intel flagsIntel = 0;
     size_t size;
     size_t sizeInPoolAllocator = 0;
+    BufferPoolSlot *bufferPoolSlot = nullptr;
     size_t hostPtrMinSize = 0;
     void *memoryStorage;
     void *hostPtr;
@@ -192,6 +199,7 @@ class MemObj : public BaseObject<_cl_mem> {
     bool isHostPtrSVM;
     bool isObjectRedescribed;
     bool isDisplayable{false};
+    bool isMapAllocationPooled = false;
     MemoryManager *memoryManager = nullptr;
     MultiGraphicsAllocation multiGraphicsAllocation;
     GraphicsAllocation *mcsAllocation = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/blit_properties.h"
 #include "shared/source/helpers/gfx_core_helper.h"
@@ -19,6 +20,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/source/program/printf_output_streamer.h"
 
 #include "opencl/source/helpers/dispatch_info.h"
 #include "opencl/source/kernel/kernel.h"
@@ -105,8 +107,13 @@ bool PrintfHandler::printEnqueueOutput() {
         }
     }
 
-    PrintFormatter printFormatter(printfOutputBuffer, printfOutputSize, kernel->is32Bit(),
-                                  usesStringMap ? &kernel->getDescriptor().kernelMetadata.printfStringsMap : nullptr);
+    auto stringLiteralMap = usesStringMap ? kernel->getDescriptor().kernelMetadata.printfStringsMap : nullptr;
+    if (PrintfOutputStreamer::isEnabled()) {
+        device.getExecutionEnvironment()->initializePrintfOutputStreamer()->submit(printfOutputBuffer, printfOutputSize, kernel->is32Bit(), stringLiteralMap);
+        return true;
+    }
+
+    PrintFormatter printFormatter(printfOutputBuffer, printfOutputSize, kernel->is32Bit(), stringLiteralMap.get());
     printFormatter.printKernelOutput();
 
     return true;
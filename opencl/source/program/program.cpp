@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
+#include "opencl/source/kernel/kernel_prototype.h"
 
 namespace NEO {
 
@@ -337,6 +338,17 @@ const char *Program::getBuildLog(uint32_t rootDeviceIndex) const {
 }
 
 void Program::cleanCurrentKernelInfo(uint32_t rootDeviceIndex) {
+    {
+        std::lock_guard<std::mutex> lock(kernelPrototypesMutex);
+        for (auto it = kernelPrototypes.begin(); it != kernelPrototypes.end();) {
+            if (it->first.second->getRootDeviceIndex() == rootDeviceIndex) {
+                it = kernelPrototypes.erase(it);
+            } else {
+                it++;
+            }
+        }
+    }
+
     auto &buildInfo = buildInfos[rootDeviceIndex];
     for (auto &kernelInfo : buildInfo.kernelInfoArray) {
         if (kernelInfo->kernelAllocation) {
@@ -370,6 +382,17 @@ void Program::cleanCurrentKernelInfo(uint32_t rootDeviceIndex) {
     metadataGenerationFlags.reset(new MetadataGenerationFlags());
 }
 
+const KernelPrototype *Program::getKernelPrototype(const KernelInfo &kernelInfo, const ClDevice &clDevice) {
+    std::lock_guard<std::mutex> lock(kernelPrototypesMutex);
+    auto it = kernelPrototypes.find({&kernelInfo, &clDevice});
+    return it != kernelPrototypes.end() ? it->second.get() : nullptr;
+}
+
+void Program::addKernelPrototype(const KernelInfo &kernelInfo, const ClDevice &clDevice, std::unique_ptr<KernelPrototype> prototype) {
+    std::lock_guard<std::mutex> lock(kernelPrototypesMutex);
+    kernelPrototypes.emplace(std::make_pair(&kernelInfo, &clDevice), std::move(prototype));
+}
+
 void Program::updateNonUniformFlag() {
     // Look for -cl-std=CL substring and extract value behind which can be 1.2 2.0 2.1 and convert to value
     auto pos = options.find(clStdOptionName);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include "opencl/source/helpers/base_object.h"
 
 #include <functional>
+#include <map>
 
 namespace NEO {
 namespace Zebin::Debug {
@@ -34,6 +35,7 @@ class Device;
 class ExecutionEnvironment;
 class Program;
 struct KernelInfo;
+struct KernelPrototype;
 template <>
 struct OpenCLObjectMapper<_cl_program> {
     typedef class Program DerivedType;
@@ -150,6 +152,8 @@ class Program : public BaseObject<_cl_program> {
     size_t getNumKernels() const;
     const KernelInfo *getKernelInfo(const char *kernelName, uint32_t rootDeviceIndex) const;
     const KernelInfo *getKernelInfo(size_t ordinal, uint32_t rootDeviceIndex) const;
+    const KernelPrototype *getKernelPrototype(const KernelInfo &kernelInfo, const ClDevice &clDevice);
+    void addKernelPrototype(const KernelInfo &kernelInfo, const ClDevice &clDevice, std::unique_ptr<KernelPrototype> prototype);
 
     cl_int getInfo(cl_program_info paramName, size_t paramValueSize,
                    void *paramValue, size_t *paramValueSizeRet);
@@ -380,6 +384,9 @@ class Program : public BaseObject<_cl_program> {
     std::mutex lockMutex;
     uint32_t exposedKernels = 0;
 
+    std::map<std::pair<const KernelInfo *, const ClDevice *>, std::unique_ptr<KernelPrototype>> kernelPrototypes;
+    std::mutex kernelPrototypesMutex;
+
     size_t exportedFunctionsKernelId = std::numeric_limits<size_t>::max();
 
     struct MetadataGenerationFlags {
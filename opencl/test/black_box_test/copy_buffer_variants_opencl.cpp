@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "CL/cl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// Measures clEnqueueCopyBuffer bandwidth for aligned and misaligned copies from 64B to 256MB and validates the copied data.
+// The built-in kernel used for the middle region depends on alignment and size: misaligned sources use the byte-shifting
+// kernel, aligned copies use 16B per work item and switch to 32B per work item at CopyBufferWideKernelThreshold (1MB by default).
+int main(int argc, char **argv) {
+    constexpr size_t minSize = 64;
+    constexpr size_t maxSize = 256 * 1024 * 1024;
+    constexpr size_t wideThreshold = 1024 * 1024;
+    int iterations = 10;
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--iterations") == 0) {
+            iterations = max(1, atoi(argv[i + 1]));
+        }
+    }
+
+    cl_int err = CL_SUCCESS;
+    cl_platform_id platform = nullptr;
+    cl_device_id device = nullptr;
+    err = clGetPlatformIDs(1, &platform, nullptr);
+    if (err != CL_SUCCESS) {
+        cout << "Error getting platforms" << endl;
+        abort();
+    }
+    err = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr);
+    if (err != CL_SUCCESS) {
+        cout << "Error getting device_id" << endl;
+        abort();
+    }
+    cl_context context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    if (err != CL_SUCCESS) {
+        cout << "Error creating context" << endl;
+        abort();
+    }
+    cl_command_queue queue = clCreateCommandQueueWithProperties(context, device, nullptr, &err);
+    if (err != CL_SUCCESS) {
+        cout << "Error creating command queue" << endl;
+        abort();
+    }
+
+    cl_ulong maxAllocSize = 0;
+    clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(maxAllocSize), &maxAllocSize, nullptr);
+    constexpr size_t maxOffset = 3;
+    const size_t sweepLimit = static_cast<size_t>(min<cl_ulong>(maxSize, maxAllocSize - maxOffset));
+
+    cout << "Iterations per size: " << iterations << "\n"
+         << setw(14) << "size [B]" << setw(10) << "offset" << setw(14) << "variant" << setw(16) << "copy [GB/s]" << "\n";
+
+    bool validationSuccessful = true;
+    for (size_t size = minSize; size <= sweepLimit; size *= 4) {
+        vector<char> srcData(size + maxOffset);
+        vector<char> dstData(size + maxOffset);
+        for (size_t i = 0; i < srcData.size(); i++) {
+            srcData[i] = static_cast<char>(i * 13 + size);
+        }
+
+        cl_mem srcBuffer = clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, srcData.size(), srcData.data(), &err);
+        if (err != CL_SUCCESS) {
+            cout << "Error creating buffer of size " << srcData.size() << endl;
+            break;
+        }
+        cl_mem dstBuffer = clCreateBuffer(context, CL_MEM_READ_WRITE, dstData.size(), nullptr, &err);
+        if (err != CL_SUCCESS) {
+            cout << "Error creating buffer of size " << dstData.size() << endl;
+            clReleaseMemObject(srcBuffer);
+            break;
+        }
+
+        for (size_t srcOffset : {size_t{0}, maxOffset}) {
+            double seconds = 0.0;
+            for (int i = 0; i < iterations; i++) {
+                auto start = chrono::high_resolution_clock::now();
+                err = clEnqueueCopyBuffer(queue, srcBuffer, dstBuffer, srcOffset, 0, size, 0, nullptr, nullptr);
+                if (err == CL_SUCCESS) {
+                    err = clFinish(queue);
+                }
+                auto end = chrono::high_resolution_clock::now();
+                if (err != CL_SUCCESS) {
+                    cout << "Error copying buffer" << endl;
+                    abort();
+                }
+                seconds += chrono::duration<double>(end - start).count();
+            }
+
+            err = clEnqueueReadBuffer(queue, dstBuffer, CL_TRUE, 0, size, dstData.data(), 0, nullptr, nullptr);
+            if (err != CL_SUCCESS) {
+                cout << "Error reading buffer" << endl;
+                abort();
+            }
+            validationSuccessful &= memcmp(srcData.data() + srcOffset, dstData.data(), size) == 0;
+
+            const char *variant = srcOffset % sizeof(cl_uint) != 0 ? "misaligned" : (size >= wideThreshold ? "wide" : "middle");
+            const double bandwidth = static_cast<double>(size) * iterations / seconds / 1e9;
+            cout << setw(14) << size << setw(10) << srcOffset << setw(14) << variant << fixed << setprecision(2) << setw(16) << bandwidth << "\n";
+        }
+
+        clReleaseMemObject(dstBuffer);
+        clReleaseMemObject(srcBuffer);
+    }
+
+    clReleaseCommandQueue(queue);
+    clReleaseContext(context);
+
+    cout << "\nCopy buffer variants results are " << (validationSuccessful ? "VALID" : "INVALID") << endl;
+    return validationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "CL/cl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// Measures blocking clEnqueueWriteBuffer/clEnqueueReadBuffer bandwidth for transfer sizes from 4KB to 1GB.
+// Run with EnableParallelCpuCopy=1 (and DoCpuCopyOnReadBuffer/DoCpuCopyOnWriteBuffer=1 to force the CPU path)
+// to compare the parallel CPU copy engine against the single threaded copy.
+int main(int argc, char **argv) {
+    constexpr size_t minSize = 4 * 1024;
+    constexpr size_t maxSize = 1024 * 1024 * 1024;
+    int iterations = 10;
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--iterations") == 0) {
+            iterations = max(1, atoi(argv[i + 1]));
+        }
+    }
+
+    cl_int err = CL_SUCCESS;
+    cl_platform_id platform = nullptr;
+    cl_device_id device = nullptr;
+    err = clGetPlatformIDs(1, &platform, nullptr);
+    if (err != CL_SUCCESS) {
+        cout << "Error getting platforms" << endl;
+        abort();
+    }
+    err = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr);
+    if (err != CL_SUCCESS) {
+        cout << "Error getting device_id" << endl;
+        abort();
+    }
+    cl_context context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    if (err != CL_SUCCESS) {
+        cout << "Error creating context" << endl;
+        abort();
+    }
+    cl_command_queue queue = clCreateCommandQueueWithProperties(context, device, nullptr, &err);
+    if (err != CL_SUCCESS) {
+        cout << "Error creating command queue" << endl;
+        abort();
+    }
+
+    cl_ulong maxAllocSize = 0;
+    clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(maxAllocSize), &maxAllocSize, nullptr);
+    const size_t sweepLimit = static_cast<size_t>(min<cl_ulong>(maxSize, maxAllocSize));
+
+    cout << "Iterations per size: " << iterations << "\n"
+         << setw(14) << "size [B]" << setw(16) << "write [GB/s]" << setw(16) << "read [GB/s]" << "\n";
+
+    bool validationSuccessful = true;
+    for (size_t size = minSize; size <= sweepLimit; size *= 4) {
+        vector<char> srcData(size);
+        vector<char> dstData(size, 0);
+        for (size_t i = 0; i < size; i++) {
+            srcData[i] = static_cast<char>(i * 13 + size);
+        }
+
+        cl_mem buffer = clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, size, nullptr, &err);
+        if (err != CL_SUCCESS) {
+            cout << "Error creating buffer of size " << size << endl;
+            break;
+        }
+
+        auto measure = [&](bool write) {
+            double seconds = 0.0;
+            for (int i = 0; i < iterations; i++) {
+                auto start = chrono::high_resolution_clock::now();
+                err = write ? clEnqueueWriteBuffer(queue, buffer, CL_TRUE, 0, size, srcData.data(), 0, nullptr, nullptr)
+                            : clEnqueueReadBuffer(queue, buffer, CL_TRUE, 0, size, dstData.data(), 0, nullptr, nullptr);
+                auto end = chrono::high_resolution_clock::now();
+                if (err != CL_SUCCESS) {
+                    cout << "Error " << (write ? "writing" : "reading") << " buffer" << endl;
+                    abort();
+                }
+                seconds += chrono::duration<double>(end - start).count();
+            }
+            return static_cast<double>(size) * iterations / seconds / 1e9;
+        };
+
+        const double writeBandwidth = measure(true);
+        const double readBandwidth = measure(false);
+        validationSuccessful &= memcmp(srcData.data(), dstData.data(), size) == 0;
+
+        cout << setw(14) << size << fixed << setprecision(2) << setw(16) << writeBandwidth << setw(16) << readBandwidth << "\n";
+        clReleaseMemObject(buffer);
+    }
+
+    clReleaseCommandQueue(queue);
+    clReleaseContext(context);
+
+    cout << "\nCPU copy bandwidth results are " << (validationSuccessful ? "VALID" : "INVALID") << endl;
+    return validationSuccessful ? 0 : 1;
+}
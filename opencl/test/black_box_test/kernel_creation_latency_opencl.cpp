@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "CL/cl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// Measures average clCreateKernel and clCloneKernel latency for a kernel with several arguments and private memory.
+// Run with EnableKernelPrototypes=1 to compare kernels copied from a prototype against full initialization.
+int main(int argc, char **argv) {
+    int iterations = 1000;
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--iterations") == 0) {
+            iterations = max(1, atoi(argv[i + 1]));
+        }
+    }
+
+    cl_int err = CL_SUCCESS;
+    cl_platform_id platform = nullptr;
+    cl_device_id device = nullptr;
+    err = clGetPlatformIDs(1, &platform, nullptr);
+    if (err != CL_SUCCESS) {
+        cout << "Error getting platforms" << endl;
+        abort();
+    }
+    err = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr);
+    if (err != CL_SUCCESS) {
+        cout << "Error getting device_id" << endl;
+        abort();
+    }
+    cl_context context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    if (err != CL_SUCCESS) {
+        cout << "Error creating context" << endl;
+        abort();
+    }
+
+    const char *source = R"===(
+__kernel void compute(__global float *dst, __global const float *src, __constant float *coeffs, float scale, int count) {
+    float values[16];
+    size_t gid = get_global_id(0);
+    for (int i = 0; i < 16; i++) {
+        values[i] = src[(gid + i) % count] * coeffs[i];
+    }
+    float sum = 0.0f;
+    for (int i = 0; i < 16; i++) {
+        sum += values[(i * 7 + gid) % 16];
+    }
+    dst[gid] = sum * scale;
+}
+)===";
+    cl_program program = clCreateProgramWithSource(context, 1, &source, nullptr, &err);
+    if (err != CL_SUCCESS) {
+        cout << "Error creating program" << endl;
+        abort();
+    }
+    err = clBuildProgram(program, 1, &device, nullptr, nullptr, nullptr);
+    if (err != CL_SUCCESS) {
+        cout << "Error building program" << endl;
+        abort();
+    }
+
+    vector<cl_kernel> kernels(iterations);
+    auto start = chrono::high_resolution_clock::now();
+    for (auto &kernel : kernels) {
+        kernel = clCreateKernel(program, "compute", &err);
+        if (err != CL_SUCCESS) {
+            cout << "Error creating kernel" << endl;
+            abort();
+        }
+    }
+    auto end = chrono::high_resolution_clock::now();
+    const double createLatency = chrono::duration<double, micro>(end - start).count() / iterations;
+
+    float scale = 2.0f;
+    err = clSetKernelArg(kernels[0], 3, sizeof(scale), &scale);
+    if (err != CL_SUCCESS) {
+        cout << "Error setting kernel argument" << endl;
+        abort();
+    }
+
+    vector<cl_kernel> clonedKernels(iterations);
+    start = chrono::high_resolution_clock::now();
+    for (auto &clonedKernel : clonedKernels) {
+        clonedKernel = clCloneKernel(kernels[0], &err);
+        if (err != CL_SUCCESS) {
+            cout << "Error cloning kernel" << endl;
+            abort();
+        }
+    }
+    end = chrono::high_resolution_clock::now();
+    const double cloneLatency = chrono::duration<double, micro>(end - start).count() / iterations;
+
+    for (auto kernel : clonedKernels) {
+        clReleaseKernel(kernel);
+    }
+    for (auto kernel : kernels) {
+        clReleaseKernel(kernel);
+    }
+    clReleaseProgram(program);
+    clReleaseContext(context);
+
+    cout << "Iterations: " << iterations << "\n"
+         << setw(16) << "clCreateKernel" << fixed << setprecision(2) << setw(12) << createLatency << " us\n"
+         << setw(16) << "clCloneKernel" << fixed << setprecision(2) << setw(12) << cloneLatency << " us" << endl;
+    return 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -133,6 +133,24 @@ HWTEST_F(ClCreateCommandQueueTest, givenOoqParametersWhenQueueIsCreatedThenComma
     retVal = clReleaseCommandQueue(cmdq);
 }
 
+HWTEST_F(ClCreateCommandQueueTest, givenBatchedDispatchForInOrderQueuesEnabledWhenInOrderQueueIsCreatedThenCommandStreamReceiverSwitchesToBatchingModeWithoutNTo1SubmissionModel) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedDispatchForInOrderQueues.set(1);
+
+    using BaseType = typename CommandQueue::BaseType;
+    cl_int retVal = CL_SUCCESS;
+    auto clDevice = castToObject<ClDevice>(testedClDevice);
+    auto mockDevice = reinterpret_cast<MockDevice *>(&clDevice->getDevice());
+    auto &csr = mockDevice->getUltCommandStreamReceiver<FamilyType>();
+    EXPECT_EQ(DispatchMode::immediateDispatch, csr.dispatchMode);
+
+    auto cmdq = clCreateCommandQueue(pContext, testedClDevice, 0, &retVal);
+    auto queue = castToObject<CommandQueue>(static_cast<BaseType *>(cmdq));
+    EXPECT_EQ(DispatchMode::batchedDispatch, queue->getGpgpuCommandStreamReceiver().getDispatchMode());
+    EXPECT_FALSE(queue->getGpgpuCommandStreamReceiver().isNTo1SubmissionModelEnabled());
+    retVal = clReleaseCommandQueue(cmdq);
+}
+
 HWTEST_F(ClCreateCommandQueueTest, givenGfxFamilyWhenQueueIsCreatedThenBcsEngineCountSetToValueFromGfxFamily) {
     using BaseType = typename CommandQueue::BaseType;
     cl_int retVal = CL_SUCCESS;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1219,6 +1219,81 @@ TEST_F(BuiltInTests, GivenUnalignedCopyBufferToBufferWhenDispatchInfoIsCreatedTh
     EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
 }
 
+TEST_F(BuiltInTests, GivenAlignedCopyBufferToBufferAboveWideKernelThresholdWhenDispatchInfoIsCreatedThenWideMiddleKernelIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CopyBufferWideKernelThreshold.set(64);
+
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferToBuffer, *pClDevice);
+
+    AlignedBuffer src;
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {64, 0, 0};
+
+    MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+
+    EXPECT_EQ(1u, multiDispatchInfo.size());
+
+    const Kernel *kernel = multiDispatchInfo.begin()->getKernel();
+    EXPECT_EQ(kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName, "CopyBufferToBufferMiddleWide");
+    EXPECT_EQ(Vec3<size_t>(64 / (8 * sizeof(uint32_t)), 1, 1), multiDispatchInfo.begin()->getGWS());
+}
+
+TEST_F(BuiltInTests, GivenWideKernelThresholdDisabledWhenCopyBufferToBufferDispatchInfoIsCreatedThenDefaultMiddleKernelIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CopyBufferWideKernelThreshold.set(0);
+
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferToBuffer, *pClDevice);
+
+    AlignedBuffer src;
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {64, 0, 0};
+
+    MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+
+    EXPECT_EQ(1u, multiDispatchInfo.size());
+
+    const Kernel *kernel = multiDispatchInfo.begin()->getKernel();
+    EXPECT_EQ(kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName, "CopyBufferToBufferMiddle");
+    EXPECT_EQ(Vec3<size_t>(64 / (4 * sizeof(uint32_t)), 1, 1), multiDispatchInfo.begin()->getGWS());
+}
+
+TEST_F(BuiltInTests, GivenCopyBufferRectWithContiguousRowsWhenDispatchInfoIsCreatedThenRowsAreCopiedAsSingleRow) {
+    if (!pClDevice->getProductHelper().isCopyBufferRectSplitSupported()) {
+        GTEST_SKIP();
+    }
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferRect, *pClDevice);
+
+    AlignedBuffer src;
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {16, 4, 1};
+    builtinOpsParams.srcRowPitch = 16;
+    builtinOpsParams.dstRowPitch = 16;
+
+    MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+
+    EXPECT_EQ(1u, multiDispatchInfo.size());
+    EXPECT_EQ(Vec3<size_t>(64 / (4 * sizeof(uint32_t)), 1, 1), multiDispatchInfo.begin()->getGWS());
+    EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
+}
+
 TEST_F(BuiltInTests, GivenReadBufferAlignedWhenDispatchInfoIsCreatedThenParamsAreCorrect) {
     BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferToBuffer, *pClDevice);
 
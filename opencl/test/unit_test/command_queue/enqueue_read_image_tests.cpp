@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/mocks/mock_builtins.h"
@@ -1068,3 +1069,48 @@ HWTEST_F(OneMipLevelReadImageTests, GivenNotMippedImageWhenReadingImageThenDoNot
     EXPECT_TRUE(builtinOpsParamsCaptured);
     EXPECT_EQ(0u, usedBuiltinOpsParams.srcMipLevel);
 }
+
+HWTEST_F(EnqueueReadImageTest, givenSvmPtrWhenReadingImageThenSvmAllocationIsUsedWithoutHostPtrSurface) {
+    REQUIRE_SVM_OR_SKIP(defaultHwInfo);
+    auto &queueContext = pCmdQ->getContext();
+    auto svmManager = queueContext.getSVMAllocsManager();
+    ASSERT_NE(nullptr, svmManager);
+    auto svmPtr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, queueContext.getRootDeviceIndices(), queueContext.getDeviceBitfields());
+    ASSERT_NE(nullptr, svmPtr);
+
+    auto retVal = EnqueueReadImageHelper<>::enqueueReadImage(pCmdQ, srcImage, CL_FALSE,
+                                                             EnqueueReadImageTraits::origin,
+                                                             EnqueueReadImageTraits::region,
+                                                             EnqueueReadImageTraits::rowPitch,
+                                                             EnqueueReadImageTraits::slicePitch,
+                                                             svmPtr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(pCmdQ->getGpgpuCommandStreamReceiver().getTemporaryAllocations().peekIsEmpty());
+
+    pCmdQ->finish();
+    svmManager->freeSVMAlloc(svmPtr);
+}
+
+HWTEST_F(EnqueueReadImageTest, givenCpuImageTransferThresholdWhenBlockingReadOfSmallLinearImageIsCalledThenDataIsCopiedOnCpu) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuImageTransferThreshold.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    std::unique_ptr<Image> image(Image1dHelper<>::create(context));
+    if (!image->isMemObjZeroCopy() || !image->mappingOnCpuAllowed()) {
+        GTEST_SKIP();
+    }
+    auto &imageDesc = image->getImageDesc();
+    auto imageData = static_cast<float *>(image->getCpuAddressForMemoryTransfer());
+    for (size_t i = 0; i < imageDesc.image_width; i++) {
+        imageData[i] = static_cast<float>(i + 1);
+    }
+    size_t origin[] = {1, 0, 0};
+    size_t region[] = {imageDesc.image_width - 1, 1, 1};
+    std::vector<float> hostData(region[0], 0.0f);
+    auto taskCount = pCmdQ->taskCount;
+
+    auto retVal = pCmdQ->enqueueReadImage(image.get(), CL_TRUE, origin, region, 0, 0, hostData.data(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCount, pCmdQ->taskCount);
+    EXPECT_EQ(0, memcmp(imageData + origin[0], hostData.data(), hostData.size() * sizeof(float)));
+}
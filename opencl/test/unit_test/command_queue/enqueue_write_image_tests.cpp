@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
@@ -747,3 +748,60 @@ HWTEST_F(EnqueueWriteImageTest, givenMultiRootDeviceImageWhenNonBlockedEnqueueWr
     pCmdQ1->release();
     pImage->release();
 }
+
+HWTEST_F(EnqueueWriteImageTest, givenSvmPtrWhenWritingImageThenSvmAllocationIsUsedWithoutHostPtrSurface) {
+    REQUIRE_SVM_OR_SKIP(defaultHwInfo);
+    auto &queueContext = pCmdQ->getContext();
+    auto svmManager = queueContext.getSVMAllocsManager();
+    ASSERT_NE(nullptr, svmManager);
+    auto svmPtr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, queueContext.getRootDeviceIndices(), queueContext.getDeviceBitfields());
+    ASSERT_NE(nullptr, svmPtr);
+
+    auto retVal = EnqueueWriteImageHelper<>::enqueueWriteImage(pCmdQ, dstImage, CL_FALSE,
+                                                               EnqueueWriteImageTraits::origin,
+                                                               EnqueueWriteImageTraits::region,
+                                                               EnqueueWriteImageTraits::rowPitch,
+                                                               EnqueueWriteImageTraits::slicePitch,
+                                                               svmPtr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(pCmdQ->getGpgpuCommandStreamReceiver().getTemporaryAllocations().peekIsEmpty());
+
+    pCmdQ->finish();
+    svmManager->freeSVMAlloc(svmPtr);
+}
+
+HWTEST_F(EnqueueWriteImageTest, givenCpuImageTransferThresholdWhenBlockingWriteOfSmallLinearImageIsCalledThenDataIsCopiedOnCpu) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuImageTransferThreshold.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    std::unique_ptr<Image> image(Image1dHelper<>::create(context));
+    if (!image->isMemObjZeroCopy() || !image->mappingOnCpuAllowed()) {
+        GTEST_SKIP();
+    }
+    auto &imageDesc = image->getImageDesc();
+    size_t origin[] = {1, 0, 0};
+    size_t region[] = {imageDesc.image_width - 1, 1, 1};
+    std::vector<float> hostData(region[0]);
+    for (size_t i = 0; i < hostData.size(); i++) {
+        hostData[i] = static_cast<float>(i + 1);
+    }
+    auto taskCount = pCmdQ->taskCount;
+
+    auto retVal = pCmdQ->enqueueWriteImage(image.get(), CL_TRUE, origin, region, 0, 0, hostData.data(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCount, pCmdQ->taskCount);
+
+    auto imageData = static_cast<float *>(image->getCpuAddressForMemoryTransfer());
+    EXPECT_EQ(0, memcmp(imageData + origin[0], hostData.data(), hostData.size() * sizeof(float)));
+}
+
+HWTEST_F(EnqueueWriteImageTest, givenCpuImageTransferThresholdWhenNonBlockingWriteImageIsCalledThenCopyKernelIsDispatched) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuImageTransferThreshold.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    auto taskCount = pCmdQ->taskCount;
+
+    auto retVal = EnqueueWriteImageHelper<>::enqueueWriteImage(pCmdQ, dstImage, CL_FALSE);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_LT(taskCount, pCmdQ->taskCount);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -727,6 +727,38 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenFlushTas
     EXPECT_EQ(csr.heaplessStateInitialized ? 4u : 2u, csr.peekLatestFlushedTaskCount());
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWithCommandBufferLimitWhenLimitIsReachedThenPendingCommandBuffersAreSubmitted) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.implicitFlush = false;
+
+    auto &csr = reinterpret_cast<UltCommandStreamReceiver<FamilyType> &>(commandQueue.getGpgpuCommandStreamReceiver());
+    if (csr.heaplessStateInitialized) {
+        GTEST_SKIP();
+    }
+    csr.overrideDispatchPolicy(DispatchMode::batchedDispatch);
+    csr.useNewResourceImplicitFlush = false;
+    csr.useGpuIdleImplicitFlush = false;
+
+    SubmissionAggregator::FlushPolicy flushPolicy;
+    flushPolicy.maxCommandBuffers = 2u;
+    csr.submissionAggregator->setFlushPolicy(flushPolicy);
+
+    flushTaskMethod<FamilyType>(csr, commandStream, 0, &dsh, &ioh, &ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1u, csr.submissionAggregator->getPendingCommandBuffers());
+    EXPECT_NE(csr.peekLatestSentTaskCount(), csr.peekLatestFlushedTaskCount());
+
+    flushTaskMethod<FamilyType>(csr, commandStream, 0, &dsh, &ioh, &ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(0u, csr.submissionAggregator->getPendingCommandBuffers());
+    EXPECT_EQ(csr.peekLatestSentTaskCount(), csr.peekLatestFlushedTaskCount());
+    EXPECT_LE(1u, csr.submissionAggregator->getBatchStatistics().batchesSubmitted);
+    EXPECT_EQ(2u, csr.submissionAggregator->getBatchStatistics().maxCommandBuffersInBatch);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenWaitForTaskCountIsCalledWithTaskCountThatWasNotYetFlushedThenBatchedCommandBuffersAreSubmitted) {
     CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
     auto &commandStream = commandQueue.getCS(4096u);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -683,3 +683,80 @@ HWTEST_F(SubmissionsAggregatorTests, givenMultipleCmdBuffersWhenNotAggregatedDur
     castToObject<Event>(event1)->release();
     castToObject<Event>(event2)->release();
 }
+
+TEST(SubmissionsAggregator, givenCommandBufferLimitWhenPendingCommandBuffersReachLimitThenFlushIsRequired) {
+    MockSubmissionAggregator submissionsAggregator;
+    SubmissionAggregator::FlushPolicy flushPolicy;
+    flushPolicy.maxCommandBuffers = 2u;
+    submissionsAggregator.setFlushPolicy(flushPolicy);
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto now = SubmissionAggregator::Clock::now();
+    EXPECT_FALSE(submissionsAggregator.isFlushRequiredByPolicy(now));
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_FALSE(submissionsAggregator.isFlushRequiredByPolicy(now));
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_EQ(2u, submissionsAggregator.getPendingCommandBuffers());
+    EXPECT_TRUE(submissionsAggregator.isFlushRequiredByPolicy(now));
+}
+
+TEST(SubmissionsAggregator, givenCommandBufferBytesLimitWhenPendingCommandBuffersUseMoreBytesThenFlushIsRequired) {
+    MockSubmissionAggregator submissionsAggregator;
+    SubmissionAggregator::FlushPolicy flushPolicy;
+    flushPolicy.maxCommandBufferBytes = 1024u;
+    submissionsAggregator.setFlushPolicy(flushPolicy);
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto now = SubmissionAggregator::Clock::now();
+
+    auto cmdBuffer = new CommandBuffer(*device);
+    cmdBuffer->batchBuffer.startOffset = 256u;
+    cmdBuffer->batchBuffer.usedSize = 1024u;
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    EXPECT_EQ(768u, submissionsAggregator.getPendingCommandBufferBytes());
+    EXPECT_FALSE(submissionsAggregator.isFlushRequiredByPolicy(now));
+
+    cmdBuffer = new CommandBuffer(*device);
+    cmdBuffer->batchBuffer.startOffset = 1024u;
+    cmdBuffer->batchBuffer.usedSize = 1280u;
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    EXPECT_EQ(1024u, submissionsAggregator.getPendingCommandBufferBytes());
+    EXPECT_TRUE(submissionsAggregator.isFlushRequiredByPolicy(now));
+}
+
+TEST(SubmissionsAggregator, givenLatencyLimitWhenOldestPendingCommandBufferWaitsLongerThenFlushIsRequired) {
+    MockSubmissionAggregator submissionsAggregator;
+    SubmissionAggregator::FlushPolicy flushPolicy;
+    flushPolicy.maxLatency = std::chrono::microseconds(500);
+    submissionsAggregator.setFlushPolicy(flushPolicy);
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    auto now = SubmissionAggregator::Clock::now();
+
+    EXPECT_FALSE(submissionsAggregator.isFlushRequiredByPolicy(now - std::chrono::seconds(1)));
+    EXPECT_TRUE(submissionsAggregator.isFlushRequiredByPolicy(now + std::chrono::milliseconds(1)));
+}
+
+TEST(SubmissionsAggregator, givenSubmittedBatchesWhenRecordingThenStatisticsAreUpdatedAndPendingCountersAreReset) {
+    MockSubmissionAggregator submissionsAggregator;
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+
+    for (int i = 0; i < 3; i++) {
+        submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    }
+    submissionsAggregator.recordSubmittedBatch(2u, 0u);
+    EXPECT_EQ(1u, submissionsAggregator.getPendingCommandBuffers());
+
+    submissionsAggregator.peekCommandBuffersList().deleteAll();
+    submissionsAggregator.recordSubmittedBatch(1u, 0u);
+    EXPECT_EQ(0u, submissionsAggregator.getPendingCommandBuffers());
+    EXPECT_FALSE(submissionsAggregator.isFlushRequiredByPolicy(SubmissionAggregator::Clock::now()));
+
+    const auto &statistics = submissionsAggregator.getBatchStatistics();
+    EXPECT_EQ(2u, statistics.batchesSubmitted);
+    EXPECT_EQ(3u, statistics.commandBuffersSubmitted);
+    EXPECT_EQ(2u, statistics.maxCommandBuffersInBatch);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/blit_commands_helper.h"
+#include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_memory_access_modes.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -20,6 +21,7 @@
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.inl"
+#include "opencl/source/execution_environment/cl_execution_environment.h"
 #include "opencl/source/gtpin/gtpin_defs.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/sharings/sharing.h"
@@ -288,6 +290,31 @@ TEST(Context, whenCreateContextThenSpecialQueueUsesInternalEngine) {
     EXPECT_EQ(internalEngine.commandStreamReceiver, specialQueueEngine.commandStreamReceiver);
 }
 
+TEST(Context, givenBuiltinsWarmUpEnabledWhenCreateContextThenCommonCopyAndFillBuiltinsAreBuiltInBackground) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBuiltinsWarmUp.set(1);
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    cl_device_id clDevice = device.get();
+    cl_int retVal = CL_SUCCESS;
+
+    auto &compilerProductHelper = device->getRootDeviceEnvironment().getHelper<CompilerProductHelper>();
+    const bool useStateless = compilerProductHelper.isForceToStatelessRequired();
+    const bool useHeapless = compilerProductHelper.isHeaplessModeEnabled();
+    auto builders = static_cast<ClExecutionEnvironment *>(device->getExecutionEnvironment())->peekBuilders(device->getRootDeviceIndex());
+    auto copyBufferToBuffer = EBuiltInOps::adjustBuiltinType<EBuiltInOps::copyBufferToBuffer>(useStateless, useHeapless);
+    auto fillBuffer = EBuiltInOps::adjustBuiltinType<EBuiltInOps::fillBuffer>(useStateless, useHeapless);
+    EXPECT_EQ(nullptr, builders[copyBufferToBuffer].first);
+
+    auto context = std::unique_ptr<MockContext>(Context::create<MockContext>(nullptr, ClDeviceVector(&clDevice, 1), nullptr, nullptr, retVal));
+    ASSERT_NE(nullptr, context);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    context.reset();
+
+    EXPECT_NE(nullptr, builders[copyBufferToBuffer].first);
+    EXPECT_NE(nullptr, builders[fillBuffer].first);
+}
+
 TEST(MultiDeviceContextTest, givenContextWithMultipleDevicesWhenGettingInfoAboutSubDevicesThenCorrectValueIsReturned) {
     MockSpecializedContext context1;
     MockUnrestrictiveContext context2;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -334,6 +334,43 @@ TEST_F(AsyncEventsHandlerTests, givenRegistredEventsWhenProcessIsCalledThenRetur
     event3->setStatus(CL_COMPLETE);
 }
 
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWhenTagIsUpdatedThenCallbacksOfAllEventsUpToCompletedTaskCountAreExecutedInOneBatch) {
+    int event1Counter(0), event2Counter(0), event3Counter(0);
+    const TaskCountType initialTag = commandQueue->getHeaplessStateInitEnabled() ? 1 : 0;
+
+    event1->setTaskStamp(0, initialTag + 1);
+    event2->setTaskStamp(0, initialTag + 2);
+    event3->setTaskStamp(0, initialTag + 3);
+
+    event3->addCallback(&this->callbackFcn, CL_COMPLETE, &event3Counter);
+    handler->registerEvent(event3.get());
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    handler->registerEvent(event1.get());
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    handler->registerEvent(event2.get());
+
+    EXPECT_EQ(event1.get(), handler->process());
+    ASSERT_EQ(1u, handler->completionQueues.size());
+    EXPECT_EQ(&commandQueue->getGpgpuCommandStreamReceiver(), handler->completionQueues[0].csr);
+    EXPECT_EQ(3u, handler->completionQueues[0].heap.size());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = static_cast<TagAddressType>(initialTag + 2);
+
+    EXPECT_EQ(event3.get(), handler->process());
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_EQ(0, event3Counter);
+    EXPECT_EQ(1, event1->getRefInternalCount());
+    EXPECT_EQ(1, event2->getRefInternalCount());
+    ASSERT_EQ(1u, handler->completionQueues.size());
+    EXPECT_EQ(1u, handler->completionQueues[0].heap.size());
+
+    event3->setStatus(CL_COMPLETE);
+    EXPECT_EQ(1, event3Counter);
+    EXPECT_EQ(nullptr, handler->process());
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
 TEST_F(AsyncEventsHandlerTests, givenEventWithoutCallbacksWhenProcessedThenDontReturnAsSleepCandidate) {
     event1->setTaskStamp(0, commandQueue->getHeaplessStateInitEnabled() ? 2 : 1);
     event2->setTaskStamp(0, commandQueue->getHeaplessStateInitEnabled() ? 3 : 2);
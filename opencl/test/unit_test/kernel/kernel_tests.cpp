@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -3575,6 +3575,61 @@ TEST_F(KernelMultiRootDeviceTest, givenKernelWithPrivateSurfaceWhenInitializeThe
     }
 }
 
+TEST(KernelPrototypeTest, givenKernelPrototypesEnabledWhenKernelIsCreatedAgainThenItIsCopiedFromPrototypeAndHasOwnPrivateSurface) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableKernelPrototypes.set(1);
+
+    MockContext context;
+    auto clDevice = context.getDevice(0);
+    MockProgram program(&context, false, context.getDevices());
+
+    MockKernelInfo kernelInfo;
+    kernelInfo.kernelDescriptor.kernelAttributes.simdSize = 1;
+    kernelInfo.setCrossThreadDataSize(64);
+    kernelInfo.setPrivateMemory(112, false, 8, 40);
+    kernelInfo.addArgBuffer(0, 0, 8);
+    kernelInfo.addArgImmediate(1, 4, 16);
+
+    cl_int retVal = CL_INVALID_VALUE;
+    std::unique_ptr<MockKernel> firstKernel(Kernel::create<MockKernel>(&program, kernelInfo, *clDevice, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, program.getKernelPrototype(kernelInfo, *clDevice));
+
+    std::unique_ptr<MockKernel> secondKernel(Kernel::create<MockKernel>(&program, kernelInfo, *clDevice, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(firstKernel->kernelArguments.size(), secondKernel->kernelArguments.size());
+    EXPECT_EQ(Kernel::BUFFER_OBJ, secondKernel->kernelArguments[0].type);
+    EXPECT_EQ(Kernel::NONE_OBJ, secondKernel->kernelArguments[1].type);
+    EXPECT_EQ(firstKernel->kernelArgHandlers, secondKernel->kernelArgHandlers);
+    EXPECT_EQ(firstKernel->slmSizes.size(), secondKernel->slmSizes.size());
+    EXPECT_EQ(firstKernel->maxKernelWorkGroupSize, secondKernel->maxKernelWorkGroupSize);
+    EXPECT_FALSE(secondKernel->isPatched());
+
+    ASSERT_EQ(firstKernel->crossThreadDataSize, secondKernel->crossThreadDataSize);
+    EXPECT_NE(firstKernel->crossThreadData, secondKernel->crossThreadData);
+    EXPECT_EQ(0, memcmp(firstKernel->crossThreadData, secondKernel->crossThreadData, 40));
+
+    ASSERT_NE(nullptr, secondKernel->privateSurface);
+    EXPECT_NE(firstKernel->privateSurface, secondKernel->privateSurface);
+    auto privateSurfaceAddress = *reinterpret_cast<uint64_t *>(ptrOffset(secondKernel->crossThreadData, 40));
+    EXPECT_EQ(secondKernel->privateSurface->getGpuAddressToPatch(), privateSurfaceAddress);
+}
+
+TEST(KernelPrototypeTest, givenKernelPrototypesDisabledWhenKernelIsCreatedThenPrototypeIsNotStored) {
+    MockContext context;
+    auto clDevice = context.getDevice(0);
+    MockProgram program(&context, false, context.getDevices());
+
+    MockKernelInfo kernelInfo;
+    kernelInfo.kernelDescriptor.kernelAttributes.simdSize = 1;
+
+    cl_int retVal = CL_INVALID_VALUE;
+    std::unique_ptr<MockKernel> kernel(Kernel::create<MockKernel>(&program, kernelInfo, *clDevice, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(nullptr, program.getKernelPrototype(kernelInfo, *clDevice));
+}
+
 class KernelCreateTest : public ::testing::Test {
   protected:
     struct MockProgram {
@@ -3589,7 +3644,7 @@ class KernelCreateTest : public ::testing::Test {
 
     struct MockKernel {
         MockKernel(MockProgram *, const KernelInfo &, ClDevice &) {}
-        int initialize() { return -1; };
+        int initializeWithPrototype() { return -1; };
         uint32_t getSlmTotalSize() const { return 0u; };
     };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -460,6 +460,75 @@ TEST_F(AggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
     }
 }
 
+TEST_F(AggregatedSmallBuffersEnabledTest, givenSizeClassesEnabledWhenSmallBuffersCreatedThenTheyShareOneSlabOfTheirSizeClass) {
+    debugManager.flags.ExperimentalSmallBufferPoolSizeClasses.set(1);
+    size = 100u;
+    std::unique_ptr<Buffer> buffer1(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    std::unique_ptr<Buffer> buffer2(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto mockBuffer1 = static_cast<MockBuffer *>(buffer1.get());
+    auto mockBuffer2 = static_cast<MockBuffer *>(buffer2.get());
+    EXPECT_NE(nullptr, mockBuffer1->bufferPoolSlot);
+    EXPECT_NE(nullptr, mockBuffer2->bufferPoolSlot);
+    EXPECT_EQ(size, buffer1->getSize());
+    EXPECT_EQ(BufferPoolSizeClassCache::sizeClasses[0], mockBuffer1->sizeInPoolAllocator);
+    EXPECT_EQ(mockBuffer1->associatedMemObject, poolAllocator->bufferPools[0].mainStorage.get());
+    EXPECT_EQ(buffer1->getOffset() + BufferPoolSizeClassCache::sizeClasses[0], buffer2->getOffset());
+    EXPECT_EQ(BufferPoolSizeClassCache::slabSize, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+
+    EXPECT_EQ(1u, poolAllocator->sizeClassCache.getSlabCount());
+    EXPECT_EQ(1u, poolAllocator->sizeClassCache.getHitCount());
+    EXPECT_EQ(1u, poolAllocator->sizeClassCache.getMissCount());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenSizeClassesEnabledWhenBufferReleasedThenItsSlotIsReusedOnlyAfterPoolStorageIsIdle) {
+    debugManager.flags.ExperimentalSmallBufferPoolSizeClasses.set(1);
+    size = 3 * MemoryConstants::kiloByte;
+    constexpr auto buffersToCreate = BufferPoolSizeClassCache::slabSize / BufferPoolSizeClassCache::sizeClasses[2];
+    std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate);
+    for (auto i = 0u; i < buffersToCreate; i++) {
+        buffers[i].reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(CL_SUCCESS, retVal);
+    }
+    EXPECT_EQ(BufferPoolSizeClassCache::sizeClasses[2], static_cast<MockBuffer *>(buffers[0].get())->sizeInPoolAllocator);
+    EXPECT_EQ(1u, poolAllocator->sizeClassCache.getSlabCount());
+
+    auto releasedOffset = buffers[0]->getOffset();
+    buffers[0].reset(nullptr);
+    buffers[0].reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(releasedOffset, buffers[0]->getOffset());
+    EXPECT_EQ(1u, poolAllocator->sizeClassCache.getSlabCount());
+
+    mockMemoryManager->deferAllocInUse = true;
+    releasedOffset = buffers[1]->getOffset();
+    buffers[1].reset(nullptr);
+    buffers[1].reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(releasedOffset, buffers[1]->getOffset());
+    EXPECT_EQ(2u, poolAllocator->sizeClassCache.getSlabCount());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenSizeClassesEnabledAndAllBuffersOfSlabReleasedWhenTrimmingThenSlabIsReturnedToPool) {
+    debugManager.flags.ExperimentalSmallBufferPoolSizeClasses.set(1);
+    size = 2 * MemoryConstants::kiloByte;
+    std::unique_ptr<Buffer> buffer1(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    std::unique_ptr<Buffer> buffer2(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(BufferPoolSizeClassCache::slabSize, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+
+    buffer1.reset(nullptr);
+    EXPECT_EQ(0u, poolAllocator->sizeClassCache.trim(*mockMemoryManager));
+    EXPECT_EQ(1u, poolAllocator->sizeClassCache.getSlabCount());
+    EXPECT_EQ(97u, poolAllocator->sizeClassCache.getFragmentationPercent());
+
+    buffer2.reset(nullptr);
+    EXPECT_EQ(1u, poolAllocator->sizeClassCache.trim(*mockMemoryManager));
+    EXPECT_EQ(0u, poolAllocator->sizeClassCache.getSlabCount());
+    EXPECT_EQ(0u, poolAllocator->bufferPools[0].chunkAllocator->getUsedSize());
+}
+
 TEST_F(AggregatedSmallBuffersKernelTest, givenBufferFromPoolWhenOffsetSubbufferIsPassedToSetKernelArgThenCorrectGpuVAIsPatched) {
     std::unique_ptr<Buffer> unusedBuffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "opencl/source/mem_obj/map_operations_handler.h"
@@ -82,27 +83,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -112,7 +113,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(1u, mockHandler.size());
@@ -124,11 +125,32 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
+}
+
+TEST_F(MapOperationsHandlerTests, givenLongReadOnlyRegionStartingBeforeOtherRegionsWhenSearchingThenLongRegionIsFound) {
+    MapInfo longRegion((void *)0x1000, 0x5000, {{0, 0, 0}}, {{0, 0, 0}}, 0);
+    mockHandler.add(longRegion.ptr, longRegion.ptrLength, mapFlags, longRegion.size, longRegion.offset, 0, allocations[0].get());
+    for (size_t i = 1; i < 3; i++) {
+        mockHandler.add(mappedPtrs[i].ptr, mappedPtrs[i].ptrLength, mapFlags, mappedPtrs[i].size, mappedPtrs[i].offset, 0, allocations[i].get());
+    }
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr((void *)0x4800, 0x10, receivedMapInfo));
+    EXPECT_EQ(longRegion.ptr, receivedMapInfo.ptr);
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr((void *)0x5ff8, 0x10, receivedMapInfo));
+
+    MapInfo writeRegion((void *)0x5800, 0x10, {{0, 0, 0}}, {{0, 0, 0}}, 0);
+    writeRegion.readOnly = false;
+    EXPECT_TRUE(mockHandler.isOverlapping(writeRegion));
+
+    mockHandler.remove(longRegion.ptr);
+    EXPECT_FALSE(mockHandler.isOverlapping(writeRegion));
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr((void *)0x4800, 0x10, receivedMapInfo));
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -221,3 +243,42 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenRemoveHandlerIsUsedT
     storage.removeHandler(&buffer);
     EXPECT_EQ(0u, storage.handlers.size());
 }
+
+TEST(MapAllocationPoolTest, givenSizeWhenGettingSizeClassThenPowerOfTwoNotSmallerThanPageIsReturnedUpToMaxSizeClass) {
+    EXPECT_EQ(MemoryConstants::pageSize, MapAllocationPool::getSizeClass(1u));
+    EXPECT_EQ(MemoryConstants::pageSize, MapAllocationPool::getSizeClass(MemoryConstants::pageSize));
+    EXPECT_EQ(4 * MemoryConstants::pageSize, MapAllocationPool::getSizeClass(3 * MemoryConstants::pageSize));
+    EXPECT_EQ(MapAllocationPool::maxSizeClass, MapAllocationPool::getSizeClass(MapAllocationPool::maxSizeClass));
+    EXPECT_EQ(0u, MapAllocationPool::getSizeClass(MapAllocationPool::maxSizeClass + 1));
+}
+
+TEST(MapAllocationPoolTest, givenReleasedEntriesWhenAcquiringThenEntryOfMatchingSizeClassAndRootDeviceIsReturned) {
+    MapAllocationPool pool;
+    int memory[2];
+    MockGraphicsAllocation allocations[2] = {{0u, &memory[0], sizeof(int)}, {1u, &memory[1], sizeof(int)}};
+
+    EXPECT_TRUE(pool.release({&memory[0], &allocations[0]}, 3 * MemoryConstants::pageSize));
+    EXPECT_TRUE(pool.release({&memory[1], &allocations[1]}, 3 * MemoryConstants::pageSize));
+    EXPECT_EQ(2u, pool.getPooledCount());
+
+    MapAllocationPool::Entry entry;
+    EXPECT_FALSE(pool.acquire(0u, MemoryConstants::pageSize, entry));
+    EXPECT_TRUE(pool.acquire(1u, 4 * MemoryConstants::pageSize, entry));
+    EXPECT_EQ(&memory[1], entry.memory);
+    EXPECT_EQ(&allocations[1], entry.allocation);
+    EXPECT_FALSE(pool.acquire(1u, 4 * MemoryConstants::pageSize, entry));
+    EXPECT_EQ(1u, pool.getPooledCount());
+}
+
+TEST(MapAllocationPoolTest, givenFullSizeClassWhenReleasingThenEntryIsNotPooled) {
+    MapAllocationPool pool;
+    MockGraphicsAllocation allocation;
+    int memory;
+
+    for (size_t i = 0; i < MapAllocationPool::maxEntriesPerSizeClass; i++) {
+        EXPECT_TRUE(pool.release({&memory, &allocation}, MemoryConstants::pageSize));
+    }
+    EXPECT_FALSE(pool.release({&memory, &allocation}, MemoryConstants::pageSize));
+    EXPECT_FALSE(pool.release({&memory, &allocation}, MapAllocationPool::maxSizeClass + 1));
+    EXPECT_EQ(MapAllocationPool::maxEntriesPerSizeClass, pool.getPooledCount());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -148,6 +148,30 @@ TEST(ZeroCopyWithDebugFlag, GivenBufferInputsThatWouldResultInZeroCopyAndDisable
     EXPECT_NE(mapAllocation, bufferAllocation);
 }
 
+TEST(ZeroCopyWithDebugFlag, GivenMapAllocationPoolEnabledWhenNonZeroCopyBufferIsReleasedThenItsMapAllocationIsReusedByNextBuffer) {
+    DebugManagerStateRestore stateRestore;
+    debugManager.flags.DisableZeroCopyForBuffers.set(true);
+    debugManager.flags.EnableMapAllocationPool.set(1);
+    MockContext context;
+    auto retVal = CL_SUCCESS;
+    auto rootDeviceIndex = context.getDevice(0)->getRootDeviceIndex();
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, 3 * MemoryConstants::pageSize, nullptr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    auto mapPtr = buffer->getBasePtrForMap(rootDeviceIndex);
+    auto mapAllocation = buffer->getMapAllocation(rootDeviceIndex);
+    ASSERT_NE(nullptr, mapAllocation);
+    EXPECT_EQ(MapAllocationPool::getSizeClass(3 * MemoryConstants::pageSize), mapAllocation->getUnderlyingBufferSize());
+    buffer.reset();
+    EXPECT_EQ(1u, context.getMapAllocationPool().getPooledCount());
+
+    buffer.reset(Buffer::create(&context, CL_MEM_READ_WRITE, 4 * MemoryConstants::pageSize, nullptr, retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(mapPtr, buffer->getBasePtrForMap(rootDeviceIndex));
+    EXPECT_EQ(mapAllocation, buffer->getMapAllocation(rootDeviceIndex));
+    EXPECT_EQ(0u, context.getMapAllocationPool().getPooledCount());
+}
+
 TEST(ZeroCopyBufferWith32BitAddressing, GivenDeviceSupporting32BitAddressingWhenAskedForBufferCreationFromHostPtrThenNonZeroCopyBufferIsReturned) {
     DebugManagerStateRestore dbgRestorer;
     debugManager.flags.Force32bitAddressing.set(true);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::allowAsyncProcess;
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
+    using AsyncEventsHandler::completionQueues;
     using AsyncEventsHandler::openThread;
     using AsyncEventsHandler::thread;
 
@@ -57,7 +58,7 @@ class MockHandler : public AsyncEventsHandler {
         openThreadCalled = true;
     }
 
-    bool peekIsListEmpty() { return list.size() == 0; }
+    bool peekIsListEmpty() { return list.size() == 0 && completionQueues.empty(); }
     bool peekIsRegisterListEmpty() { return registerList.size() == 0; }
     std::atomic<int> transferCounter;
     bool openThreadCalled = false;
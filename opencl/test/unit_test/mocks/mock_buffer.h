@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,7 @@ class MockBuffer : public MockBufferStorage, public Buffer {
     using Buffer::offset;
     using Buffer::size;
     using MemObj::associatedMemObject;
+    using MemObj::bufferPoolSlot;
     using MemObj::context;
     using MemObj::hostPtr;
     using MemObj::isZeroCopy;
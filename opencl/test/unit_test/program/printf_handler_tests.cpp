@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/helpers/local_memory_access_modes.h"
 #include "shared/source/kernel/implicit_args_helper.h"
+#include "shared/source/program/printf_output_streamer.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -115,6 +116,39 @@ TEST_F(PrintfHandlerTests, givenKernelWithImplicitArgsWhenPreparingPrintfHandler
     EXPECT_EQ(printfSurface->getGpuAddress(), pImplicitArgs->printfBufferPtr);
 }
 
+TEST_F(PrintfHandlerTests, givenAsyncPrintfEnabledWhenPrintEnqueueOutputIsCalledThenOutputIsHandedOverToPrintfOutputStreamer) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableAsyncPrintf.set(1);
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context(device.get());
+
+    auto kernelInfo = std::make_unique<MockKernelInfo>();
+    kernelInfo->setPrintfSurface(sizeof(uintptr_t), 0);
+
+    auto program = std::make_unique<MockProgram>(&context, false, toClDeviceVector(*device));
+
+    uint64_t crossThread[10]{};
+    auto kernel = std::make_unique<MockKernel>(program.get(), *kernelInfo, *device);
+    kernel->setCrossThreadData(&crossThread, sizeof(uint64_t) * 8);
+
+    MockMultiDispatchInfo multiDispatchInfo(device.get(), kernel.get());
+    std::unique_ptr<PrintfHandler> printfHandler(PrintfHandler::create(multiDispatchInfo, device->getDevice()));
+    printfHandler->prepareDispatch(multiDispatchInfo);
+
+    auto executionEnvironment = device->getExecutionEnvironment();
+    EXPECT_EQ(nullptr, executionEnvironment->printfOutputStreamer.get());
+
+    EXPECT_TRUE(printfHandler->printEnqueueOutput());
+
+    auto streamer = executionEnvironment->printfOutputStreamer.get();
+    ASSERT_NE(nullptr, streamer);
+    EXPECT_TRUE(streamer->isThreadRunning());
+    executionEnvironment->drainPrintfOutput();
+    EXPECT_EQ(0u, streamer->getPendingCount());
+    EXPECT_EQ(1u, streamer->getSpareSnapshotCount());
+}
+
 HWTEST_F(PrintfHandlerTests, givenEnabledStatelessCompressionWhenPrintEnqueueOutputIsCalledThenBCSEngineIsUsedToDecompressPrintfOutput) {
     HardwareInfo hwInfo = *defaultHwInfo;
     hwInfo.capabilityTable.blitterOperationsSupported = true;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -146,4 +146,12 @@ void BuiltIns::freeSipKernels(MemoryManager *memoryManager) {
     }
 }
 
+bool isWideCopyKernelPreferred(size_t middleSizeBytes) {
+    auto threshold = static_cast<int64_t>(wideCopyKernelDefaultThreshold);
+    if (debugManager.flags.CopyBufferWideKernelThreshold.get() != -1) {
+        threshold = debugManager.flags.CopyBufferWideKernelThreshold.get();
+    }
+    return threshold > 0 && middleSizeBytes >= static_cast<uint64_t>(threshold);
+}
+
 } // namespace NEO
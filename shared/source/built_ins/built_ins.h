@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
 namespace NEO {
 typedef std::vector<char> BuiltinResourceT;
 
+class CompilerCache;
 class Device;
 class SipKernel;
 class MemoryManager;
@@ -61,6 +62,10 @@ std::string createBuiltinResourceName(EBuiltInOps::Type builtin, const std::stri
 StackVec<std::string, 3> getBuiltinResourceNames(EBuiltInOps::Type builtin, BuiltinCode::ECodeType type, const Device &device);
 const char *getBuiltinAsString(EBuiltInOps::Type builtin);
 
+// copies with a middle region of at least this size move 32 bytes per work item instead of 16
+inline constexpr size_t wideCopyKernelDefaultThreshold = 1024 * 1024;
+bool isWideCopyKernelPreferred(size_t middleSizeBytes);
+
 class Storage {
   public:
     Storage(const std::string &rootPath)
@@ -127,14 +132,25 @@ class EmbeddedStorage : public Storage {
 class BuiltinsLib {
   public:
     BuiltinsLib();
+    MOCKABLE_VIRTUAL ~BuiltinsLib();
     BuiltinCode getBuiltinCode(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
 
+    // Binaries built from source or intermediate built-ins are kept in the persistent compiler cache, so that
+    // later processes can skip the compilation. The key is built like the CompilerInterface one, from the code,
+    // both option sets and the IGC revision, library size and modification time. Returns the key under which the
+    // built binary should be stored when the code still needs to be compiled, empty string otherwise.
+    std::string loadCachedBinary(BuiltinCode &code, ConstStringRef options, ConstStringRef internalOptions);
+    void cacheBinary(const std::string &cacheKey, const char *binary, size_t binarySize);
+
   protected:
     BuiltinResourceT getBuiltinResource(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
+    MOCKABLE_VIRTUAL CompilerCache *getBinaryCache();
 
     using StoragesContainerT = std::vector<std::unique_ptr<Storage>>;
     StoragesContainerT allStorages; // sorted by priority allStorages[0] will be checked before allStorages[1], etc.
 
+    std::unique_ptr<CompilerCache> binaryCache;
+    std::once_flag binaryCacheInitialized;
     std::mutex mutex;
 };
 
@@ -1,11 +1,14 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -171,6 +174,8 @@ BuiltinsLib::BuiltinsLib() {
     allStorages.push_back(std::unique_ptr<Storage>(new FileStorage(getDriverInstallationPath())));
 }
 
+BuiltinsLib::~BuiltinsLib() = default;
+
 BuiltinCode BuiltinsLib::getBuiltinCode(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device) {
     std::lock_guard<std::mutex> lockRaii{mutex};
 
@@ -217,4 +222,54 @@ BuiltinResourceT BuiltinsLib::getBuiltinResource(EBuiltInOps::Type builtin, Buil
     return builtinResource;
 }
 
+CompilerCache *BuiltinsLib::getBinaryCache() {
+    std::call_once(binaryCacheInitialized, [this] {
+        if (debugManager.flags.EnableBuiltinsBinaryCache.get() != 1) {
+            return;
+        }
+        auto cacheConfig = getDefaultCompilerCacheConfig();
+        if (cacheConfig.enabled) {
+            binaryCache = std::make_unique<CompilerCache>(cacheConfig);
+        }
+    });
+    return binaryCache.get();
+}
+
+std::string BuiltinsLib::loadCachedBinary(BuiltinCode &code, ConstStringRef options, ConstStringRef internalOptions) {
+    if (code.type != BuiltinCode::ECodeType::source && code.type != BuiltinCode::ECodeType::intermediate) {
+        return "";
+    }
+    auto cache = getBinaryCache();
+    if (cache == nullptr) {
+        return "";
+    }
+
+    auto compilerInterface = code.targetDevice->getCompilerInterface();
+    if (compilerInterface == nullptr) {
+        return "";
+    }
+
+    auto cacheKey = cache->getCachedFileName(code.targetDevice->getHardwareInfo(),
+                                             ArrayRef<const char>(code.resource.data(), code.resource.size()),
+                                             options, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(),
+                                             compilerInterface->getIgcRevision(), compilerInterface->getIgcLibSize(), compilerInterface->getIgcLibMTime());
+
+    size_t cachedBinarySize = 0u;
+    auto cachedBinary = cache->loadCachedBinary(cacheKey, cachedBinarySize);
+    if (cachedBinary == nullptr) {
+        return cacheKey;
+    }
+    code.resource.assign(cachedBinary.get(), cachedBinary.get() + cachedBinarySize);
+    code.type = BuiltinCode::ECodeType::binary;
+    return "";
+}
+
+void BuiltinsLib::cacheBinary(const std::string &cacheKey, const char *binary, size_t binarySize) {
+    auto cache = getBinaryCache();
+    if (cache == nullptr || cacheKey.empty() || binary == nullptr || binarySize == 0u) {
+        return;
+    }
+    cache->cacheBinary(cacheKey, binary, binarySize);
+}
+
 } // namespace NEO
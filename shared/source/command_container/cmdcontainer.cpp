@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,8 @@
 #include "shared/source/os_interface/os_context.h"
 namespace NEO {
 
+std::atomic<uint64_t> CommandContainer::indirectHeapGenerationCounter(0);
+
 CommandContainer::~CommandContainer() {
     if (!device) {
         DEBUG_BREAK_IF(device);
@@ -57,6 +59,8 @@ CommandContainer::CommandContainer() {
     }
 
     residencyContainer.reserve(startingResidencyContainerSize);
+    residencySet.reserve(startingResidencyContainerSize);
+    indirectHeapGeneration = ++indirectHeapGenerationCounter;
 
     if (debugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.get() != -1) {
         isHandleFenceCompletionRequired = !static_cast<bool>(debugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.get());
@@ -138,7 +142,7 @@ CommandContainer::ErrorCode CommandContainer::initialize(Device *device, Allocat
             if (!allocationIndirectHeaps[i]) {
                 return ErrorCode::outOfDeviceMemory;
             }
-            residencyContainer.push_back(allocationIndirectHeaps[i]);
+            addToResidencyContainer(allocationIndirectHeaps[i]);
 
             bool requireInternalHeap = false;
             if (IndirectHeap::Type::indirectObject == heapType) {
@@ -166,7 +170,40 @@ void CommandContainer::addToResidencyContainer(GraphicsAllocation *alloc) {
         return;
     }
 
-    this->residencyContainer.push_back(alloc);
+    if (this->residencySetDirty) {
+        rebuildResidencySet();
+    }
+    if (this->residencySet.insert(alloc).second) {
+        this->residencyContainer.push_back(alloc);
+    }
+}
+
+void CommandContainer::removeFromResidencyContainer(GraphicsAllocation *alloc) {
+    if (this->residencySetDirty) {
+        rebuildResidencySet();
+    }
+    auto allocIt = std::find(this->residencyContainer.begin(), this->residencyContainer.end(), alloc);
+    if (allocIt != this->residencyContainer.end()) {
+        this->residencyContainer.erase(allocIt);
+    }
+    this->residencySet.erase(alloc);
+}
+
+void CommandContainer::clearResidencyContainer() {
+    this->residencyContainer.clear();
+    this->residencySet.clear();
+    this->residencySetDirty = false;
+}
+
+// The vector handed out by getResidencyContainer() may be modified without updating the membership set,
+// so the set is marked dirty there and rebuilt on next use, dropping duplicates in order.
+void CommandContainer::rebuildResidencySet() {
+    this->residencySetDirty = false;
+    this->residencySet.clear();
+    auto uniqueEnd = std::remove_if(this->residencyContainer.begin(), this->residencyContainer.end(), [this](GraphicsAllocation *alloc) {
+        return !this->residencySet.insert(alloc).second;
+    });
+    this->residencyContainer.erase(uniqueEnd, this->residencyContainer.end());
 }
 
 bool CommandContainer::swapStreams() {
@@ -178,14 +215,16 @@ bool CommandContainer::swapStreams() {
 }
 
 void CommandContainer::removeDuplicatesFromResidencyContainer() {
-    std::sort(this->residencyContainer.begin(), this->residencyContainer.end());
-    this->residencyContainer.erase(std::unique(this->residencyContainer.begin(), this->residencyContainer.end()), this->residencyContainer.end());
+    if (this->residencySetDirty) {
+        rebuildResidencySet();
+    }
 }
 
 void CommandContainer::reset() {
     setDirtyStateForAllHeaps(true);
     slmSize = std::numeric_limits<uint32_t>::max();
-    getResidencyContainer().clear();
+    indirectHeapGeneration = ++indirectHeapGenerationCounter;
+    clearResidencyContainer();
     if (getHeapHelper()) {
         for (auto deallocation : deallocationContainer) {
             if ((deallocation->getAllocationType() == AllocationType::internalHeap) || (deallocation->getAllocationType() == AllocationType::linearStream)) {
@@ -295,7 +334,7 @@ void CommandContainer::createAndAssignNewHeap(HeapType heapType, size_t size) {
     indirectHeap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                                 newAlloc->getUnderlyingBufferSize());
     auto newBase = indirectHeap->getHeapGpuBase();
-    getResidencyContainer().push_back(newAlloc);
+    addToResidencyContainer(newAlloc);
     if (this->immediateCmdListCsr) {
         this->storeAllocationAndFlushTagUpdate(oldAlloc);
     } else {
@@ -393,7 +432,7 @@ void CommandContainer::prepareBindfulSsh() {
                                                                                                       defaultHeapAllocationAlignment,
                                                                                                       device->getRootDeviceIndex());
             UNRECOVERABLE_IF(!allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
-            residencyContainer.push_back(allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
+            addToResidencyContainer(allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
 
             indirectHeaps[IndirectHeap::Type::surfaceState] = std::make_unique<IndirectHeap>(allocationIndirectHeaps[IndirectHeap::Type::surfaceState], false);
             indirectHeaps[IndirectHeap::Type::surfaceState]->getSpace(reservedSshSize);
@@ -528,12 +567,12 @@ void CommandContainer::fillReusableAllocationLists() {
     for (auto i = 0u; i < amountToFill; i++) {
         auto allocToReuse = obtainNextCommandBufferAllocation();
         this->immediateReusableAllocationList->pushTailOne(*allocToReuse);
-        this->getResidencyContainer().push_back(allocToReuse);
+        this->addToResidencyContainer(allocToReuse);
 
         if (this->useSecondaryCommandStream) {
             auto hostAllocToReuse = obtainNextCommandBufferAllocation(true);
             this->immediateReusableAllocationList->pushTailOne(*hostAllocToReuse);
-            this->getResidencyContainer().push_back(hostAllocToReuse);
+            this->addToResidencyContainer(hostAllocToReuse);
         }
     }
 
@@ -552,7 +591,7 @@ void CommandContainer::fillReusableAllocationLists() {
                                                              defaultHeapAllocationAlignment,
                                                              device->getRootDeviceIndex());
             if (heapToReuse != nullptr) {
-                this->getResidencyContainer().push_back(heapToReuse);
+                this->addToResidencyContainer(heapToReuse);
             }
             this->heapHelper->storeHeapAllocation(heapToReuse);
         }
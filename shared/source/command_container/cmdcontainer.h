@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,9 +11,11 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/indirect_heap/indirect_heap_type.h"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
@@ -80,11 +82,17 @@ class CommandContainer : public NonCopyableOrMovableClass {
 
     CmdBufferContainer &getCmdBufferAllocations() { return cmdBufferAllocations; }
 
-    ResidencyContainer &getResidencyContainer() { return residencyContainer; }
+    ResidencyContainer &getResidencyContainer() {
+        residencySetDirty = true;
+        return residencyContainer;
+    }
+    const ResidencyContainer &peekResidencyContainer() const { return residencyContainer; }
 
     std::vector<GraphicsAllocation *> &getDeallocationContainer() { return deallocationContainer; }
 
     void addToResidencyContainer(GraphicsAllocation *alloc);
+    void removeFromResidencyContainer(GraphicsAllocation *alloc);
+    void clearResidencyContainer();
     void removeDuplicatesFromResidencyContainer();
 
     LinearStream *getCommandStream() { return commandStream.get(); }
@@ -190,6 +198,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     uint32_t &nextIddInBlockRef() { return nextIddInBlock; }
     HeapContainer &getSshAllocations() { return sshAllocations; }
     uint64_t &currentLinearStreamStartOffsetRef() { return currentLinearStreamStartOffset; }
+    uint64_t getIndirectHeapGeneration() const { return indirectHeapGeneration; }
 
     void setUsingPrimaryBuffer(bool value) {
         usingPrimaryBuffer = value;
@@ -217,12 +226,14 @@ class CommandContainer : public NonCopyableOrMovableClass {
     IndirectHeap *initIndirectHeapReservation(ReservedIndirectHeap *indirectHeapReservation, size_t size, size_t alignment, HeapType heapType);
     bool skipHeapAllocationCreation(HeapType heapType);
     size_t getHeapSize(HeapType heapType);
+    void rebuildResidencySet();
     void alignPrimaryEnding(void *endPtr, size_t exactUsedSize);
 
     GraphicsAllocation *allocationIndirectHeaps[HeapType::numTypes] = {};
 
     CmdBufferContainer cmdBufferAllocations;
     ResidencyContainer residencyContainer;
+    std::unordered_set<GraphicsAllocation *> residencySet;
     std::vector<GraphicsAllocation *> deallocationContainer;
     HeapContainer sshAllocations;
 
@@ -238,6 +249,9 @@ class CommandContainer : public NonCopyableOrMovableClass {
     uint64_t instructionHeapBaseAddress = 0u;
     uint64_t indirectObjectHeapBaseAddress = 0u;
     uint64_t currentLinearStreamStartOffset = 0u;
+    // unique across all containers, renewed on reset; identifies payloads already written to the indirect object heap
+    static std::atomic<uint64_t> indirectHeapGenerationCounter;
+    uint64_t indirectHeapGeneration = 0u;
 
     void *iddBlock = nullptr;
     Device *device = nullptr;
@@ -270,6 +284,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     bool doubleSbaWa = false;
     bool usingPrimaryBuffer = false;
     bool globalBindlessHeapsEnabled = false;
+    bool residencySetDirty = false;
 };
 
 } // namespace NEO
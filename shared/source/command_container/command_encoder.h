@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@ class ProductHelper;
 
 struct DeviceInfo;
 struct DispatchKernelEncoderI;
+struct DispatchTemplateKey;
 struct EncodeSurfaceStateArgs;
 struct HardwareInfo;
 struct KernelDescriptor;
@@ -59,6 +60,7 @@ struct EncodeDispatchKernelArgs {
     void *cpuWalkerBuffer = nullptr;
     void *cpuPayloadBuffer = nullptr;
     void *outImplicitArgsPtr = nullptr;
+    void *outIndirectDataPtr = nullptr;
     std::list<void *> *additionalCommands = nullptr;
     PreemptionMode preemptionMode = PreemptionMode::Initial;
     NEO::RequiredPartitionDim requiredPartitionDim = NEO::RequiredPartitionDim::none;
@@ -84,6 +86,7 @@ struct EncodeDispatchKernelArgs {
     bool interruptEvent = false;
     bool immediateScratchAddressPatching = false;
     bool makeCommandView = false;
+    bool requiresExclusiveIndirectData = false;
 
     bool requiresSystemMemoryFence() const {
         return (isHostScopeSignalEvent && isKernelUsingSystemAllocation);
@@ -185,6 +188,13 @@ struct EncodeDispatchKernel {
     template <typename WalkerType>
     static void setupPostSyncForRegularEvent(WalkerType &walkerCmd, const EncodeDispatchKernelArgs &args);
 
+    template <typename WalkerType>
+    static void encodeWalkerTemplate(WalkerType &walkerCmd, const EncodeDispatchKernelArgs &args);
+    static bool isWalkerPartitioned(const EncodeDispatchKernelArgs &args);
+    static bool isDispatchTemplateCacheAllowed(const EncodeDispatchKernelArgs &args);
+    static bool isIndirectDataReuseAllowed(const EncodeDispatchKernelArgs &args, const ImplicitArgs *pImplicitArgs);
+    static void getDispatchTemplateKey(DispatchTemplateKey &key, const EncodeDispatchKernelArgs &args);
+
     template <typename WalkerType>
     static void setWalkerRegionSettings(WalkerType &walkerCmd, const HardwareInfo &hwInfo, uint32_t partitionCount, uint32_t workgroupSize, uint32_t maxWgCountPerTile, bool requiredWalkOrder);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 #include "shared/source/command_container/command_encoder.h"
+#include "shared/source/command_container/dispatch_template_cache.h"
+#include "shared/source/command_container/indirect_data_cache.h"
 #include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
@@ -82,50 +84,24 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    WalkerType walkerCmd = Family::template getInitGpuWalker<WalkerType>();
-    auto &idd = walkerCmd.getInterfaceDescriptor();
-
-    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
-                                             sizePerThreadData, rootDeviceEnvironment);
-
     bool localIdsGenerationByRuntime = args.dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
     auto requiredWorkgroupOrder = args.dispatchInterface->getRequiredWorkgroupOrder();
-
-    {
-        auto isaAllocation = args.dispatchInterface->getIsaAllocation();
-        UNRECOVERABLE_IF(nullptr == isaAllocation);
-
-        uint64_t kernelStartPointer = args.dispatchInterface->getIsaOffsetInParentAllocation();
-        if constexpr (heaplessModeEnabled) {
-            kernelStartPointer += isaAllocation->getGpuAddress();
-        } else {
-            kernelStartPointer += isaAllocation->getGpuAddressToPatch();
-        }
-
-        if (!localIdsGenerationByRuntime) {
-            kernelStartPointer += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
-        }
-        idd.setKernelStartPointer(kernelStartPointer);
-    }
-    if (args.dispatchInterface->getKernelDescriptor().kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
-        idd.setSoftwareExceptionEnable(1);
-    }
-
     auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
-    idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
-
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor.kernelAttributes.barrierCount,
-                                                       hwInfo);
 
-    EncodeDispatchKernel<Family>::encodeEuSchedulingPolicy(&idd, kernelDescriptor, args.defaultPipelinedThreadArbitrationPolicy);
-
-    auto slmSize = EncodeDispatchKernel<Family>::computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize());
-
-    if (debugManager.flags.OverrideSlmAllocationSize.get() != -1) {
-        slmSize = static_cast<uint32_t>(debugManager.flags.OverrideSlmAllocationSize.get());
+    WalkerType walkerCmd;
+    DispatchTemplateKey dispatchTemplateKey;
+    auto dispatchTemplateCache = EncodeDispatchKernel<Family>::isDispatchTemplateCacheAllowed(args) ? args.dispatchInterface->getDispatchTemplateCache() : nullptr;
+    if (dispatchTemplateCache) {
+        EncodeDispatchKernel<Family>::getDispatchTemplateKey(dispatchTemplateKey, args);
     }
-    idd.setSharedLocalMemorySize(slmSize);
+    if (!dispatchTemplateCache || !dispatchTemplateCache->find(dispatchTemplateKey, walkerCmd)) {
+        walkerCmd = Family::template getInitGpuWalker<WalkerType>();
+        EncodeDispatchKernel<Family>::encodeWalkerTemplate<WalkerType>(walkerCmd, args);
+        if (dispatchTemplateCache) {
+            dispatchTemplateCache->store(dispatchTemplateKey, walkerCmd);
+        }
+    }
+    auto &idd = walkerCmd.getInterfaceDescriptor();
 
     auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     bool sshProgrammingRequired = true;
@@ -184,9 +160,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    auto preemptionMode = args.device->getDebugger() ? PreemptionMode::ThreadGroup : args.preemptionMode;
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, preemptionMode);
-
     uint32_t samplerCount = 0;
 
     if constexpr (Family::supportsSampler && heaplessModeEnabled == false) {
@@ -248,7 +221,26 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     uint32_t sizeForImplicitArgsPatching = NEO::ImplicitArgsHelper::getSizeForImplicitArgsPatching(pImplicitArgs, kernelDescriptor, !localIdsGenerationByRuntime, rootDeviceEnvironment);
     uint32_t sizeForImplicitArgsStruct = NEO::ImplicitArgsHelper::getSizeForImplicitArgsStruct(pImplicitArgs, kernelDescriptor, true, rootDeviceEnvironment);
     uint32_t iohRequiredSize = sizeThreadData + sizeForImplicitArgsPatching + args.reserveExtraPayloadSpace;
-    {
+
+    auto perThreadDataPtr = args.dispatchInterface->getPerThreadData();
+    auto perThreadDataSize = perThreadDataPtr != nullptr ? sizePerThreadDataForWholeGroup : 0u;
+    auto indirectDataCache = EncodeDispatchKernel<Family>::isIndirectDataReuseAllowed(args, pImplicitArgs) ? args.dispatchInterface->getIndirectDataCache() : nullptr;
+    IndirectDataLocation indirectDataLocation = {};
+    IndirectDataLocation reusedIndirectData = {};
+    bool indirectDataReused = false;
+    if (indirectDataCache) {
+        auto heap = container.getIndirectHeap(HeapType::indirectObject);
+        UNRECOVERABLE_IF(!heap);
+        indirectDataLocation.container = &container;
+        indirectDataLocation.heapAllocation = heap->getGraphicsAllocation();
+        indirectDataLocation.heapGeneration = container.getIndirectHeapGeneration();
+        indirectDataReused = indirectDataCache->find(indirectDataLocation, crossThreadData, sizeCrossThreadData, perThreadDataPtr, perThreadDataSize, reusedIndirectData);
+    }
+
+    if (indirectDataReused) {
+        offsetThreadData = reusedIndirectData.offsetThreadData;
+        args.outIndirectDataPtr = reusedIndirectData.cpuPtr;
+    } else {
         void *ptr = nullptr;
         if (!args.makeCommandView) {
             auto heap = container.getIndirectHeap(HeapType::indirectObject);
@@ -281,18 +273,25 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         } else {
             ptr = args.cpuPayloadBuffer;
         }
+        args.outIndirectDataPtr = ptr;
 
         if (sizeCrossThreadData > 0) {
             memcpy_s(ptr, sizeCrossThreadData,
                      crossThreadData, sizeCrossThreadData);
         }
 
-        auto perThreadDataPtr = args.dispatchInterface->getPerThreadData();
         if (perThreadDataPtr != nullptr) {
             ptr = ptrOffset(ptr, sizeCrossThreadData);
             memcpy_s(ptr, sizePerThreadDataForWholeGroup,
                      perThreadDataPtr, sizePerThreadDataForWholeGroup);
         }
+
+        if (indirectDataCache) {
+            indirectDataLocation.heapAllocation = container.getIndirectHeap(HeapType::indirectObject)->getGraphicsAllocation();
+            indirectDataLocation.offsetThreadData = offsetThreadData;
+            indirectDataLocation.cpuPtr = args.outIndirectDataPtr;
+            indirectDataCache->store(indirectDataLocation, crossThreadData, sizeCrossThreadData, perThreadDataPtr, perThreadDataSize);
+        }
     }
 
     if (args.isHeaplessStateInitEnabled == false && !args.makeCommandView) {
@@ -352,20 +351,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
     container.getIndirectHeap(HeapType::indirectObject)->align(NEO::EncodeDispatchKernel<Family>::getDefaultIOHAlignment());
 
-    EncodeDispatchKernel<Family>::encodeThreadData(walkerCmd,
-                                                   nullptr,
-                                                   threadDims,
-                                                   args.dispatchInterface->getGroupSize(),
-                                                   kernelDescriptor.kernelAttributes.simdSize,
-                                                   kernelDescriptor.kernelAttributes.numLocalIdChannels,
-                                                   threadsPerThreadGroup,
-                                                   args.dispatchInterface->getThreadExecutionMask(),
-                                                   localIdsGenerationByRuntime,
-                                                   inlineDataProgramming,
-                                                   args.isIndirect,
-                                                   requiredWorkgroupOrder,
-                                                   rootDeviceEnvironment);
-
     if (args.inOrderExecInfo) {
         EncodeDispatchKernel<Family>::setupPostSyncForInOrderExec<WalkerType>(walkerCmd, args);
     } else if (args.eventAddress) {
@@ -382,9 +367,8 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     walkerCmd.setPredicateEnable(args.isPredicate);
 
-    auto threadGroupCount = walkerCmd.getThreadGroupIdXDimension() * walkerCmd.getThreadGroupIdYDimension() * walkerCmd.getThreadGroupIdZDimension();
-    EncodeDispatchKernel<Family>::adjustInterfaceDescriptorData(idd, *args.device, hwInfo, threadGroupCount, kernelDescriptor.kernelAttributes.numGrfRequired, walkerCmd);
     if (debugManager.flags.PrintKernelDispatchParameters.get()) {
+        auto threadGroupCount = walkerCmd.getThreadGroupIdXDimension() * walkerCmd.getThreadGroupIdYDimension() * walkerCmd.getThreadGroupIdZDimension();
         fprintf(stdout, "kernel, %s, grfCount, %d, simdSize, %d, tilesCount, %d, implicitScaling, %s, threadGroupCount, %d, numberOfThreadsInGpgpuThreadGroup, %d, threadGroupDimensions, %d, %d, %d, threadGroupDispatchSize enum, %d\n",
                 kernelDescriptor.kernelMetadata.kernelName.c_str(),
                 kernelDescriptor.kernelAttributes.numGrfRequired,
@@ -399,24 +383,9 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
                 idd.getThreadGroupDispatchSize());
     }
 
-    EncodeDispatchKernel<Family>::setupPreferredSlmSize(&idd, rootDeviceEnvironment, threadsPerThreadGroup,
-                                                        args.dispatchInterface->getSlmTotalSize(),
-                                                        args.dispatchInterface->getSlmPolicy());
-
-    EncodeWalkerArgs walkerArgs{
-        args.isCooperative ? KernelExecutionType::concurrent : KernelExecutionType::defaultType,
-        args.requiresSystemMemoryFence(),
-        kernelDescriptor,
-        args.requiredDispatchWalkOrder,
-        args.additionalSizeParam,
-        args.device->getDeviceInfo().maxFrontEndThreads};
-    EncodeDispatchKernel<Family>::encodeAdditionalWalkerFields(rootDeviceEnvironment, walkerCmd, walkerArgs);
-
-    EncodeDispatchKernel<Family>::overrideDefaultValues(walkerCmd, idd);
-
     uint32_t workgroupSize = args.dispatchInterface->getGroupSize()[0] * args.dispatchInterface->getGroupSize()[1] * args.dispatchInterface->getGroupSize()[2];
     bool isRequiredWorkGroupOrder = args.requiredDispatchWalkOrder != NEO::RequiredDispatchWalkOrder::none;
-    if (args.partitionCount > 1 && !args.isInternal) {
+    if (EncodeDispatchKernel<Family>::isWalkerPartitioned(args)) {
         const uint64_t workPartitionAllocationGpuVa = args.device->getDefaultEngine().commandStreamReceiver->getWorkPartitionAllocationGpuAddress();
 
         ImplicitScalingDispatchCommandArgs implicitScalingArgs{
@@ -441,7 +410,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         args.partitionCount = implicitScalingArgs.partitionCount;
     } else {
         args.partitionCount = 1;
-        EncodeDispatchKernel<Family>::setWalkerRegionSettings(walkerCmd, hwInfo, args.partitionCount, workgroupSize, args.maxWgCountPerTile, isRequiredWorkGroupOrder);
 
         if (!args.makeCommandView) {
             auto buffer = listCmdBufferStream->getSpaceForCmd<WalkerType>();
@@ -465,6 +433,161 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
 }
 
+template <typename Family>
+template <typename WalkerType>
+void EncodeDispatchKernel<Family>::encodeWalkerTemplate(WalkerType &walkerCmd, const EncodeDispatchKernelArgs &args) {
+    constexpr bool heaplessModeEnabled = Family::template isHeaplessMode<WalkerType>();
+    const HardwareInfo &hwInfo = args.device->getHardwareInfo();
+    auto &rootDeviceEnvironment = args.device->getRootDeviceEnvironment();
+
+    const auto &kernelDescriptor = args.dispatchInterface->getKernelDescriptor();
+    auto sizeCrossThreadData = args.dispatchInterface->getCrossThreadDataSize();
+    auto sizePerThreadData = args.dispatchInterface->getPerThreadDataSize();
+    auto threadDims = static_cast<const uint32_t *>(args.threadGroupDimensions);
+    auto &idd = walkerCmd.getInterfaceDescriptor();
+
+    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
+                                             sizePerThreadData, rootDeviceEnvironment);
+
+    bool localIdsGenerationByRuntime = args.dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
+    auto requiredWorkgroupOrder = args.dispatchInterface->getRequiredWorkgroupOrder();
+
+    {
+        auto isaAllocation = args.dispatchInterface->getIsaAllocation();
+        UNRECOVERABLE_IF(nullptr == isaAllocation);
+
+        uint64_t kernelStartPointer = args.dispatchInterface->getIsaOffsetInParentAllocation();
+        if constexpr (heaplessModeEnabled) {
+            kernelStartPointer += isaAllocation->getGpuAddress();
+        } else {
+            kernelStartPointer += isaAllocation->getGpuAddressToPatch();
+        }
+
+        if (!localIdsGenerationByRuntime) {
+            kernelStartPointer += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
+        }
+        idd.setKernelStartPointer(kernelStartPointer);
+    }
+    if (kernelDescriptor.kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
+        idd.setSoftwareExceptionEnable(1);
+    }
+
+    auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
+    idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
+
+    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                       kernelDescriptor.kernelAttributes.barrierCount,
+                                                       hwInfo);
+
+    EncodeDispatchKernel<Family>::encodeEuSchedulingPolicy(&idd, kernelDescriptor, args.defaultPipelinedThreadArbitrationPolicy);
+
+    auto slmSize = EncodeDispatchKernel<Family>::computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize());
+
+    if (debugManager.flags.OverrideSlmAllocationSize.get() != -1) {
+        slmSize = static_cast<uint32_t>(debugManager.flags.OverrideSlmAllocationSize.get());
+    }
+    idd.setSharedLocalMemorySize(slmSize);
+
+    auto preemptionMode = args.device->getDebugger() ? PreemptionMode::ThreadGroup : args.preemptionMode;
+    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, preemptionMode);
+
+    bool inlineDataProgramming = EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor) &&
+                                 std::min(WalkerType::getInlineDataSize(), sizeCrossThreadData) != 0;
+
+    EncodeDispatchKernel<Family>::encodeThreadData(walkerCmd,
+                                                   nullptr,
+                                                   threadDims,
+                                                   args.dispatchInterface->getGroupSize(),
+                                                   kernelDescriptor.kernelAttributes.simdSize,
+                                                   kernelDescriptor.kernelAttributes.numLocalIdChannels,
+                                                   threadsPerThreadGroup,
+                                                   args.dispatchInterface->getThreadExecutionMask(),
+                                                   localIdsGenerationByRuntime,
+                                                   inlineDataProgramming,
+                                                   args.isIndirect,
+                                                   requiredWorkgroupOrder,
+                                                   rootDeviceEnvironment);
+
+    auto threadGroupCount = walkerCmd.getThreadGroupIdXDimension() * walkerCmd.getThreadGroupIdYDimension() * walkerCmd.getThreadGroupIdZDimension();
+    EncodeDispatchKernel<Family>::adjustInterfaceDescriptorData(idd, *args.device, hwInfo, threadGroupCount, kernelDescriptor.kernelAttributes.numGrfRequired, walkerCmd);
+
+    EncodeDispatchKernel<Family>::setupPreferredSlmSize(&idd, rootDeviceEnvironment, threadsPerThreadGroup,
+                                                        args.dispatchInterface->getSlmTotalSize(),
+                                                        args.dispatchInterface->getSlmPolicy());
+
+    EncodeWalkerArgs walkerArgs{
+        args.isCooperative ? KernelExecutionType::concurrent : KernelExecutionType::defaultType,
+        args.requiresSystemMemoryFence(),
+        kernelDescriptor,
+        args.requiredDispatchWalkOrder,
+        args.additionalSizeParam,
+        args.device->getDeviceInfo().maxFrontEndThreads};
+    EncodeDispatchKernel<Family>::encodeAdditionalWalkerFields(rootDeviceEnvironment, walkerCmd, walkerArgs);
+
+    EncodeDispatchKernel<Family>::overrideDefaultValues(walkerCmd, idd);
+
+    if (!EncodeDispatchKernel<Family>::isWalkerPartitioned(args)) {
+        uint32_t workgroupSize = args.dispatchInterface->getGroupSize()[0] * args.dispatchInterface->getGroupSize()[1] * args.dispatchInterface->getGroupSize()[2];
+        bool isRequiredWorkGroupOrder = args.requiredDispatchWalkOrder != NEO::RequiredDispatchWalkOrder::none;
+        EncodeDispatchKernel<Family>::setWalkerRegionSettings(walkerCmd, hwInfo, 1u, workgroupSize, args.maxWgCountPerTile, isRequiredWorkGroupOrder);
+    }
+}
+
+template <typename Family>
+bool EncodeDispatchKernel<Family>::isWalkerPartitioned(const EncodeDispatchKernelArgs &args) {
+    return args.partitionCount > 1 && !args.isInternal;
+}
+
+template <typename Family>
+bool EncodeDispatchKernel<Family>::isDispatchTemplateCacheAllowed(const EncodeDispatchKernelArgs &args) {
+    if (debugManager.flags.EnableDispatchTemplateCache.get() != 1) {
+        return false;
+    }
+    return !args.isIndirect && !args.makeCommandView;
+}
+
+template <typename Family>
+bool EncodeDispatchKernel<Family>::isIndirectDataReuseAllowed(const EncodeDispatchKernelArgs &args, const ImplicitArgs *pImplicitArgs) {
+    if (debugManager.flags.EnableIndirectDataReuse.get() != 1) {
+        return false;
+    }
+    return !args.isIndirect &&
+           !args.makeCommandView &&
+           !args.isKernelDispatchedFromImmediateCmdList &&
+           !args.isHeaplessModeEnabled &&
+           !args.requiresExclusiveIndirectData &&
+           args.reserveExtraPayloadSpace == 0 &&
+           pImplicitArgs == nullptr;
+}
+
+template <typename Family>
+void EncodeDispatchKernel<Family>::getDispatchTemplateKey(DispatchTemplateKey &key, const EncodeDispatchKernelArgs &args) {
+    auto isaAllocation = args.dispatchInterface->getIsaAllocation();
+    auto groupSize = args.dispatchInterface->getGroupSize();
+    auto threadDims = static_cast<const uint32_t *>(args.threadGroupDimensions);
+
+    key.device = reinterpret_cast<uintptr_t>(args.device);
+    key.kernelStartPointer = (isaAllocation ? isaAllocation->getGpuAddress() : 0u) + args.dispatchInterface->getIsaOffsetInParentAllocation();
+    for (uint32_t i = 0; i < 3; i++) {
+        key.groupSize[i] = groupSize[i];
+        key.groupCount[i] = threadDims[i];
+    }
+    key.slmTotalSize = args.dispatchInterface->getSlmTotalSize();
+    key.slmPolicy = static_cast<uint32_t>(args.dispatchInterface->getSlmPolicy());
+    key.crossThreadDataSize = args.dispatchInterface->getCrossThreadDataSize();
+    key.perThreadDataSize = args.dispatchInterface->getPerThreadDataSize();
+    key.preemptionMode = static_cast<uint32_t>(args.preemptionMode);
+    key.threadArbitrationPolicy = static_cast<uint32_t>(args.defaultPipelinedThreadArbitrationPolicy);
+    key.kernelExecutionType = args.isCooperative ? 1u : 0u;
+    key.requiredDispatchWalkOrder = static_cast<uint32_t>(args.requiredDispatchWalkOrder);
+    key.additionalSizeParam = args.additionalSizeParam;
+    key.maxWgCountPerTile = args.maxWgCountPerTile;
+    key.requiredSystemFence = args.requiresSystemMemoryFence() ? 1u : 0u;
+    key.partitioned = EncodeDispatchKernel<Family>::isWalkerPartitioned(args) ? 1u : 0u;
+    key.debuggerState = (args.device->getDebugger() ? 1u : 0u) | (args.device->getL0Debugger() ? 2u : 0u);
+    key.slmAllocationSizeOverride = static_cast<uint32_t>(debugManager.flags.OverrideSlmAllocationSize.get());
+}
+
 template <typename Family>
 template <typename WalkerType>
 void EncodeDispatchKernel<Family>::setupPostSyncForRegularEvent(WalkerType &walkerCmd, const EncodeDispatchKernelArgs &args) {
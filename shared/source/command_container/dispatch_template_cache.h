@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+// Inputs of the launch-invariant walker fields programmed by EncodeDispatchKernel::encodeWalkerTemplate.
+// Compared bytewise, so the layout must stay free of padding.
+struct DispatchTemplateKey {
+    uint64_t device = 0;
+    uint64_t kernelStartPointer = 0;
+    uint32_t groupSize[3] = {};
+    uint32_t groupCount[3] = {};
+    uint32_t slmTotalSize = 0;
+    uint32_t slmPolicy = 0;
+    uint32_t crossThreadDataSize = 0;
+    uint32_t perThreadDataSize = 0;
+    uint32_t preemptionMode = 0;
+    uint32_t threadArbitrationPolicy = 0;
+    uint32_t kernelExecutionType = 0;
+    uint32_t requiredDispatchWalkOrder = 0;
+    uint32_t additionalSizeParam = 0;
+    uint32_t maxWgCountPerTile = 0;
+    uint32_t requiredSystemFence = 0;
+    uint32_t partitioned = 0;
+    uint32_t debuggerState = 0;
+    uint32_t slmAllocationSizeOverride = 0;
+
+    bool operator==(const DispatchTemplateKey &other) const {
+        return memcmp(this, &other, sizeof(DispatchTemplateKey)) == 0;
+    }
+};
+static_assert(sizeof(DispatchTemplateKey) == 2 * sizeof(uint64_t) + 20 * sizeof(uint32_t), "DispatchTemplateKey must not contain padding");
+
+// Per-kernel cache of pre-encoded walker commands. A hit replaces the launch-invariant part of the walker
+// encoding with a copy; fields depending on heaps, payload, events and predication are still programmed per launch.
+class DispatchTemplateCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxWalkerSize = 256u;
+    static constexpr size_t maxEntries = 8u;
+
+    template <typename WalkerType>
+    bool find(const DispatchTemplateKey &key, WalkerType &walkerCmd) const {
+        static_assert(sizeof(WalkerType) <= maxWalkerSize);
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &entry : entries) {
+            if (entry.key == key) {
+                memcpy(&walkerCmd, entry.walker.data(), sizeof(WalkerType));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename WalkerType>
+    void store(const DispatchTemplateKey &key, const WalkerType &walkerCmd) {
+        static_assert(sizeof(WalkerType) <= maxWalkerSize);
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry *entry = nullptr;
+        if (entries.size() < maxEntries) {
+            entry = &entries.emplace_back();
+        } else {
+            entry = &entries[nextVictim];
+            nextVictim = (nextVictim + 1) % maxEntries;
+        }
+        entry->key = key;
+        memcpy(entry->walker.data(), &walkerCmd, sizeof(WalkerType));
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        nextVictim = 0;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+  protected:
+    struct Entry {
+        DispatchTemplateKey key;
+        alignas(8) std::array<uint8_t, maxWalkerSize> walker;
+    };
+
+    std::vector<Entry> entries;
+    size_t nextVictim = 0;
+    mutable std::mutex mutex;
+};
+
+} // namespace NEO
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class CommandContainer;
+class GraphicsAllocation;
+
+// Location of an indirect data payload already written to the indirect object heap.
+struct IndirectDataLocation {
+    const CommandContainer *container = nullptr;
+    const GraphicsAllocation *heapAllocation = nullptr;
+    uint64_t heapGeneration = 0;
+    uint64_t offsetThreadData = 0;
+    void *cpuPtr = nullptr;
+};
+
+// Per-kernel record of the last payload uploaded to the indirect object heap. A launch whose cross-thread
+// and per-thread data did not change since the previous upload into the same, still valid heap points the
+// walker at the previous payload instead of copying it again.
+class IndirectDataCache : NonCopyableOrMovableClass {
+  public:
+    bool find(const IndirectDataLocation &location, const uint8_t *crossThreadData, size_t crossThreadDataSize,
+              const uint8_t *perThreadData, size_t perThreadDataSize, IndirectDataLocation &outLocation) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!valid ||
+            lastLocation.container != location.container ||
+            lastLocation.heapAllocation != location.heapAllocation ||
+            lastLocation.heapGeneration != location.heapGeneration ||
+            !isPayloadEqual(crossThreadData, crossThreadDataSize, perThreadData, perThreadDataSize)) {
+            return false;
+        }
+        outLocation = lastLocation;
+        reuseCount++;
+        bytesSaved += crossThreadDataSize + perThreadDataSize;
+        return true;
+    }
+
+    void store(const IndirectDataLocation &location, const uint8_t *crossThreadData, size_t crossThreadDataSize,
+               const uint8_t *perThreadData, size_t perThreadDataSize) {
+        std::lock_guard<std::mutex> lock(mutex);
+        lastLocation = location;
+        crossThreadDataSnapshotSize = crossThreadDataSize;
+        payloadSnapshot.resize(crossThreadDataSize + perThreadDataSize);
+        if (crossThreadDataSize > 0) {
+            memcpy(payloadSnapshot.data(), crossThreadData, crossThreadDataSize);
+        }
+        if (perThreadDataSize > 0) {
+            memcpy(payloadSnapshot.data() + crossThreadDataSize, perThreadData, perThreadDataSize);
+        }
+        valid = true;
+    }
+
+    void invalidate() {
+        std::lock_guard<std::mutex> lock(mutex);
+        valid = false;
+    }
+
+    uint64_t getReuseCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return reuseCount;
+    }
+
+    uint64_t getBytesSaved() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return bytesSaved;
+    }
+
+  protected:
+    bool isPayloadEqual(const uint8_t *crossThreadData, size_t crossThreadDataSize, const uint8_t *perThreadData, size_t perThreadDataSize) const {
+        if (crossThreadDataSnapshotSize != crossThreadDataSize || payloadSnapshot.size() != crossThreadDataSize + perThreadDataSize) {
+            return false;
+        }
+        if (crossThreadDataSize > 0 && memcmp(payloadSnapshot.data(), crossThreadData, crossThreadDataSize) != 0) {
+            return false;
+        }
+        return perThreadDataSize == 0 || memcmp(payloadSnapshot.data() + crossThreadDataSize, perThreadData, perThreadDataSize) == 0;
+    }
+
+    IndirectDataLocation lastLocation;
+    std::vector<uint8_t> payloadSnapshot;
+    size_t crossThreadDataSnapshotSize = 0;
+    uint64_t reuseCount = 0;
+    uint64_t bytesSaved = 0;
+    bool valid = false;
+    mutable std::mutex mutex;
+};
+
+} // namespace NEO
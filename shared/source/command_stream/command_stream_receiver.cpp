@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,17 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 
     latestSentStatelessMocsConfig = CacheSettings::unknownMocs;
     submissionAggregator.reset(new SubmissionAggregator());
+    SubmissionAggregator::FlushPolicy flushPolicy;
+    if (debugManager.flags.BatchedDispatchMaxCommandBuffers.get() > 0) {
+        flushPolicy.maxCommandBuffers = static_cast<uint32_t>(debugManager.flags.BatchedDispatchMaxCommandBuffers.get());
+    }
+    if (debugManager.flags.BatchedDispatchMaxCommandBufferBytes.get() > 0) {
+        flushPolicy.maxCommandBufferBytes = static_cast<size_t>(debugManager.flags.BatchedDispatchMaxCommandBufferBytes.get());
+    }
+    if (debugManager.flags.BatchedDispatchMaxLatencyUs.get() > 0) {
+        flushPolicy.maxLatency = std::chrono::microseconds(debugManager.flags.BatchedDispatchMaxLatencyUs.get());
+    }
+    submissionAggregator->setFlushPolicy(flushPolicy);
     if (ApiSpecificConfig::getApiType() == ApiSpecificConfig::L0) {
         this->dispatchMode = DispatchMode::immediateDispatch;
     }
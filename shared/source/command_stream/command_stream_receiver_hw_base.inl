@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -634,6 +634,9 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             FlushStampUpdateHelper flushStampUpdateHelper;
             flushStampUpdateHelper.insert(primaryCmdBuffer->flushStamp->getStampReference());
 
+            uint32_t commandBuffersInBatch = 1u;
+            size_t commandBufferBytesInBatch = SubmissionAggregator::getCommandBufferBytes(*primaryCmdBuffer);
+
             currentPipeControlForNooping = primaryCmdBuffer->pipeControlThatMayBeErasedLocation;
             epiloguePipeControlLocation = primaryCmdBuffer->epiloguePipeControlLocation;
 
@@ -656,6 +659,8 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                 epiloguePipeControlLocation = nextCommandBuffer->epiloguePipeControlLocation;
 
                 flushStampUpdateHelper.insert(nextCommandBuffer->flushStamp->getStampReference());
+                commandBuffersInBatch++;
+                commandBufferBytesInBatch += SubmissionAggregator::getCommandBufferBytes(*nextCommandBuffer);
                 auto nextCommandBufferAddress = nextCommandBuffer->batchBuffer.commandBufferAllocation->getGpuAddress();
                 auto offsetedCommandBuffer = (uint64_t)ptrOffset(nextCommandBufferAddress, nextCommandBuffer->batchBuffer.startOffset);
                 auto cpuAddressForCommandBufferDestination = ptrOffset(nextCommandBuffer->batchBuffer.commandBufferAllocation->getUnderlyingBuffer(), nextCommandBuffer->batchBuffer.startOffset);
@@ -708,6 +713,11 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                 break;
             }
 
+            this->submissionAggregator->recordSubmittedBatch(commandBuffersInBatch, commandBufferBytesInBatch);
+            PRINT_DEBUG_STRING(debugManager.flags.PrintBatchedDispatchStatistics.get(), stdout,
+                               "Batched dispatch: %u command buffers (%zu bytes) with %zu resources submitted as one batch\n",
+                               commandBuffersInBatch, commandBufferBytesInBatch, surfacesForSubmit.size());
+
             // after flush task level is closed
             this->taskLevel++;
 
@@ -2257,6 +2267,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::handleBatchedDispatchImplicitFlu
         this->newResources = false;
     }
     implicitFlush |= checkImplicitFlushForGpuIdle();
+    implicitFlush |= this->submissionAggregator->isFlushRequiredByPolicy(SubmissionAggregator::Clock::now());
 
     if (implicitFlush) {
         this->flushBatchedSubmissions();
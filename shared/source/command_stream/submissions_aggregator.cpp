@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,10 +10,53 @@
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 
+#include <algorithm>
+
+size_t NEO::SubmissionAggregator::getCommandBufferBytes(const CommandBuffer &commandBuffer) {
+    const auto &batchBuffer = commandBuffer.batchBuffer;
+    return batchBuffer.usedSize > batchBuffer.startOffset ? batchBuffer.usedSize - batchBuffer.startOffset : 0u;
+}
+
 void NEO::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer) {
+    if (this->cmdBuffers.peekIsEmpty()) {
+        this->pendingCommandBuffers = 0u;
+        this->pendingCommandBufferBytes = 0u;
+        this->oldestPendingRecordTime = Clock::now();
+    }
+    this->pendingCommandBuffers++;
+    this->pendingCommandBufferBytes += getCommandBufferBytes(*commandBuffer);
     this->cmdBuffers.pushTailOne(*commandBuffer);
 }
 
+bool NEO::SubmissionAggregator::isFlushRequiredByPolicy(Clock::time_point now) const {
+    if (pendingCommandBuffers == 0u) {
+        return false;
+    }
+    if (flushPolicy.maxCommandBuffers > 0u && pendingCommandBuffers >= flushPolicy.maxCommandBuffers) {
+        return true;
+    }
+    if (flushPolicy.maxCommandBufferBytes > 0u && pendingCommandBufferBytes >= flushPolicy.maxCommandBufferBytes) {
+        return true;
+    }
+    if (flushPolicy.maxLatency.count() > 0 && now - oldestPendingRecordTime >= flushPolicy.maxLatency) {
+        return true;
+    }
+    return false;
+}
+
+void NEO::SubmissionAggregator::recordSubmittedBatch(uint32_t commandBuffersInBatch, size_t commandBufferBytesInBatch) {
+    batchStatistics.batchesSubmitted++;
+    batchStatistics.commandBuffersSubmitted += commandBuffersInBatch;
+    batchStatistics.maxCommandBuffersInBatch = std::max(batchStatistics.maxCommandBuffersInBatch, commandBuffersInBatch);
+
+    pendingCommandBuffers -= std::min(pendingCommandBuffers, commandBuffersInBatch);
+    pendingCommandBufferBytes -= std::min(pendingCommandBufferBytes, commandBufferBytesInBatch);
+    if (this->cmdBuffers.peekIsEmpty()) {
+        pendingCommandBuffers = 0u;
+        pendingCommandBufferBytes = 0u;
+    }
+}
+
 void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId) {
     auto primaryCommandBuffer = this->cmdBuffers.peekHead();
     auto currentInspection = this->inspectionId;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/pipe_control_args.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <chrono>
 #include <vector>
 namespace NEO {
 class Device;
@@ -93,12 +94,44 @@ using ResourcePackage = StackVec<GraphicsAllocation *, 128>;
 
 class SubmissionAggregator {
   public:
+    using Clock = std::chrono::steady_clock;
+
+    static size_t getCommandBufferBytes(const CommandBuffer &commandBuffer);
+
+    // limits of pending command buffers after which batched dispatch flushes implicitly, zero means no limit
+    struct FlushPolicy {
+        uint32_t maxCommandBuffers = 0u;
+        size_t maxCommandBufferBytes = 0u;
+        std::chrono::microseconds maxLatency{0};
+    };
+
+    struct BatchStatistics {
+        uint64_t batchesSubmitted = 0u;
+        uint64_t commandBuffersSubmitted = 0u;
+        uint32_t maxCommandBuffersInBatch = 0u;
+    };
+
     void recordCommandBuffer(CommandBuffer *commandBuffer);
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
 
+    void setFlushPolicy(const FlushPolicy &policy) { flushPolicy = policy; }
+    const FlushPolicy &getFlushPolicy() const { return flushPolicy; }
+    bool isFlushRequiredByPolicy(Clock::time_point now) const;
+    void recordSubmittedBatch(uint32_t commandBuffersInBatch, size_t commandBufferBytesInBatch);
+    const BatchStatistics &getBatchStatistics() const { return batchStatistics; }
+
+    uint32_t getPendingCommandBuffers() const { return pendingCommandBuffers; }
+    size_t getPendingCommandBufferBytes() const { return pendingCommandBufferBytes; }
+
   protected:
     CommandBufferList cmdBuffers;
     uint32_t inspectionId = 1;
+
+    FlushPolicy flushPolicy;
+    BatchStatistics batchStatistics;
+    Clock::time_point oldestPendingRecordTime{};
+    size_t pendingCommandBufferBytes = 0u;
+    uint32_t pendingCommandBuffers = 0u;
 };
 } // namespace NEO
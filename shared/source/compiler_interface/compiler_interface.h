@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -132,6 +132,10 @@ class CompilerInterface {
     bool addOptionDisableZebin(std::string &options, std::string &internalOptions);
     bool disableZebin(std::string &options, std::string &internalOptions);
 
+    const std::string &getIgcRevision() const { return igcRevision; }
+    size_t getIgcLibSize() const { return igcLibSize; }
+    time_t getIgcLibMTime() const { return igcLibMTime; }
+
   protected:
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> &&cache, bool requireFcl);
     MOCKABLE_VIRTUAL bool loadFcl();
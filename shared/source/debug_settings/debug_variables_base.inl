@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,8 @@ DECLARE_DEBUG_VARIABLE(bool, MakeEachEnqueueBlocking, false, "Equivalent of fini
 DECLARE_DEBUG_VARIABLE(bool, DisableResourceRecycling, false, "Disable resource recycling optimization")
 DECLARE_DEBUG_VARIABLE(bool, TrackParentEvents, false, "Events track their parents")
 DECLARE_DEBUG_VARIABLE(bool, RebuildPrecompiledKernels, false, "Forces driver to recompile precompiled kernels from sources; applies to builtin and user kernels")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBuiltinsBinaryCache, -1, "Store built-in binaries compiled from sources in the persistent compiler cache and reuse them in later processes, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBuiltinsWarmUp, -1, "Build the most common copy and fill built-ins in a background thread at context creation, -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(bool, DisableKernelRecompilation, false, "Disable kernel recompilation")
 DECLARE_DEBUG_VARIABLE(bool, LoopAtDriverInit, false, "Adds endless loop in DebugSettingsManager constructor")
 DECLARE_DEBUG_VARIABLE(bool, DoNotValidateDriverPath, false, "Skips validating DriverStore path allowing to load driver from any path")
@@ -114,6 +116,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideGpuAddressSpace, -1, "Set GPU address sp
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideMaxWorkgroupSize, -1, "Set max workgroup size; ignore when -1")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnReadBuffer, -1, "Override CPU copy behavior for buffer reads; values = -1: default, 0: do not use CPU copy, 1: triggers CPU copy path for Read Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnWriteBuffer, -1, "Override CPU copy behavior for buffer writes; values = -1: default, 0: do not use CPU copy, 1: triggers CPU copy path for Write Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelCpuCopy, -1, "Split large CPU copies of buffer reads and writes across a persistent pool of worker threads -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelCpuCopyThreshold, -1, "Minimal size in bytes of a CPU copy split across worker threads; -1: default (2MB)")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelCpuCopyWorkerCount, -1, "Number of worker threads used for parallel CPU copies in addition to the calling thread; -1: default (hardware threads - 1, up to 7)")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyStreamingStoresThreshold, -1, "Minimal size in bytes of a CPU copy into locked device memory done with streaming stores; -1: default (256KB)")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuImageTransferThreshold, -1, "Maximal size in bytes of a blocking image read or write done on CPU for linear, CPU accessible images instead of dispatching a copy kernel; -1: default (disabled), 0: disabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableMapAllocationPool, -1, "Reuse host memory and map allocations of released memory objects for mapping non zero-copy memory objects -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableZeroCopyReadOnlyMap, -1, "Map buffers in lockable local memory for reading by returning a pointer to the locked allocation instead of copying to host memory -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncPrintf, -1, "Decode kernel printf output on a background thread from a host snapshot of the printf buffer -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelPrototypes, -1, "Initialize kernels created from the same program and device by copying a prototype captured at first creation -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnEnqueue, -1, "-1: default, -2: always, x: pause on enqueue number x and ask for user confirmation before and after execution, counted from 0")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnBlitCopy, -1, "-1: default, -2: always, x: pause on blit enqueue number x and ask for user confirmation before and after execution, counted from 0. Note that single blit enqueue may have multiple copy instructions")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnGpuMode, -1, "-1: default (before and after), 0: before only, 1: after only")
@@ -292,6 +303,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, StandaloneInOrderTimestampAllocationEnabled, -1,
 DECLARE_DEBUG_VARIABLE(int32_t, ForceComputeWalkerPostSyncFlushWithWrite, -1, "-1: ignore. >=0: Force PostSync cache flush and override postSync immediate write address to given value")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferStateInitSubmissionToFirstRegularUsage, -1, "-1: ignore, 0: disabled, 1: enabled. If set, instead of initializing at Device creation, submit initial state during first usage (eg. kernel submission)")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceNonWalkerSplitMemoryCopy, -1, "-1: default, 0: disabled, 1: enabled. If set, memory copy will be executed as single byte copy Walker without performance optimizations")
+DECLARE_DEBUG_VARIABLE(int64_t, CopyBufferWideKernelThreshold, -1, "Minimal size in bytes of the middle region of a buffer copy that is copied with 32 bytes per work item, -1: default (1MB), 0: disabled, >0: threshold")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideTimestampWidth, -1, "-1: default from KMD, > 0: Override timestamp width used for profiling. Requires XeKMD kernel.")
 
 /*LOGGING FLAGS*/
@@ -300,6 +312,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintOsContextInitializations, false, "print initia
 DECLARE_DEBUG_VARIABLE(bool, PrintDeviceAndEngineIdOnSubmission, false, "print submissions device and engine IDs to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintExecutionBuffer, false, "print execution buffer information to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOsForSubmit, false, "print all BOs passed to submission")
+DECLARE_DEBUG_VARIABLE(bool, PrintBatchedDispatchStatistics, false, "print number of command buffers and resources in each batch submitted in batched dispatch mode")
 DECLARE_DEBUG_VARIABLE(bool, PrintDebugSettings, false, "Dump all debug variables settings to text file. Print to stdout if value is different than default.")
 DECLARE_DEBUG_VARIABLE(bool, PrintDebugMessages, false, "when enabled, some debug messages will be propagated to console")
 DECLARE_DEBUG_VARIABLE(bool, PrintXeLogs, false, "when enabled, xe logs will be propagated to console")
@@ -335,6 +348,11 @@ DECLARE_DEBUG_VARIABLE(bool, PrintBlitDispatchDetails, false, "Print blit dispat
 DECLARE_DEBUG_VARIABLE(bool, PrintKmdTimes, false, "Print ioctl times")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlEntries, false, "Print ioctl being called")
 DECLARE_DEBUG_VARIABLE(bool, PrintUmdSharedMigration, false, "Print log message when shared allocation is being migrated by UMD")
+DECLARE_DEBUG_VARIABLE(bool, PrintAdaptiveUsmPrefetchStatistics, false, "Print adaptive USM prefetch accuracy statistics when memory manager is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintUmdPageFaultStatistics, false, "Print count and latency histogram of CPU page faults handled by UMD when page fault manager is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintHostAllocationHugePages, false, "Print address, size and result of huge page backing requests for host allocations")
+DECLARE_DEBUG_VARIABLE(bool, PrintIndirectDataReuseStatistics, false, "Print per kernel count of reused indirect data payloads and bytes of payload upload saved, when kernel is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintEventPoolAllocationCacheStatistics, false, "Print hit rate of event pool allocation cache when driver handle is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, PrintImageBlitBlockCopyCmdDetails, false, "Prints XY_BLOCK_COPY_BLT command details")
 DECLARE_DEBUG_VARIABLE(bool, PrintCompletionFenceUsage, false, "Prints all usages of DRM completion fences")
 DECLARE_DEBUG_VARIABLE(bool, PrintKernelDispatchParameters, false, "Prints kernel parameters used in tg dispatch size heuristic on encode dispatch kernel")
@@ -368,6 +386,10 @@ DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then max
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater than 0, driver performs implicit flush every N submissions.")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForNewResource, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platform specific, 0: force disable, 1: force enable")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxCommandBuffers, -1, "In batched dispatch mode, flush implicitly when this many command buffers are pending. -1: default (no limit)")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxCommandBufferBytes, -1, "In batched dispatch mode, flush implicitly when pending command buffers use this many bytes. -1: default (no limit)")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxLatencyUs, -1, "In batched dispatch mode, flush implicitly on next enqueue when the oldest pending command buffer waits this many microseconds. -1: default (no limit)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedDispatchForInOrderQueues, -1, "Use batched dispatch for in-order OpenCL command queues, as it is done for out-of-order queues -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EventWaitOnHost, -1, "Wait for events on host instead of program semaphores for them, works for append kernel launch with immediate command list, -1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalkerForAllQueues, -1, "Enable cache flush after walker even if queue doesn't require it")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideUseKmdWaitFunction, -1, "-1: default (L0: disabled), 0: disabled, 1: enabled. It uses only busy loop to wait or busy loop with KMD wait function, when KMD fallback is enabled")
@@ -534,6 +556,13 @@ DECLARE_DEBUG_VARIABLE(int32_t, SignalAllEventPackets, -1, "All packets of event
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBcsSwControlWa, -1, "Enable BCS WA via BCSSWCONTROL MMIO. -1: default, 0: disabled, 1: if src in system mem, 2: if dst in system mem, 3: if src and dst in system mem, 4: always")
 DECLARE_DEBUG_VARIABLE(bool, EnableHostAllocationMemPolicy, false, "Enables Memory Policy for host allocation")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideHostAllocationMemPolicyMode, -1, "Override Memory Policy mode for host allocation -1: default (use the system configuration), 0: MPOL_DEFAULT, 1: MPOL_PREFERRED, 2: MPOL_BIND, 3: MPOL_INTERLEAVED, 4: MPOL_LOCAL, 5: MPOL_PREFERRED_MANY")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceLocalNumaPlacement, -1, "Place host memory on the NUMA node local to the device -1: default (disabled), 0: disabled, 1: driver internal allocations, 2: driver internal and USM host allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostAllocationHugePages, -1, "Back large userptr host allocations with 2MB transparent huge pages -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, HostAllocationHugePagesThreshold, -1, "Minimal size in bytes of host allocation backed with huge pages, -1: default (4MB)")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideDeviceNumaNode, -1, "Override NUMA node reported for the device, -1: default (read from sysfs), >=0: node index")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchTemplateCache, -1, "Reuse per-kernel pre-encoded walker templates for repeated launches with the same dispatch parameters -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIndirectDataReuse, -1, "Point repeated launches of a kernel with unchanged payload at indirect data already written to the command list heap -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventPoolAllocationCache, -1, "Recycle backing storage of destroyed single device, non-IPC event pools for new pools with the same layout -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableFtrTile64Optimization, 0, "Control feature Tile64 Optimization flag passed to gmmlib. -1: pass as-is, 0: disable flag(default due to NEO-10623), 1: enable flag");
 DECLARE_DEBUG_VARIABLE(int32_t, ForceTheMaximumNumberOfOutstandingRayqueriesPerSs, -1, "Set the maximum number of outstanding RayQueries per SS, -1: default, 0: 128, 1: 256, 2: 512, 3: 1024")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceDispatchTimeoutCounter, -1, "Set timeout for Synchronous Ray Tracing, -1: default, 0: 64, 1: 128, 2: 192, 3: 256, 4: 512, 5: 1024, 6: 2048, 7: 4096")
@@ -557,11 +586,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableCustomLocalMemoryAlignment, 0,
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableDeviceAllocationCache, -1, "Experimentally enable device usm allocation cache. Use X% of device memory.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableHostAllocationCache, -1, "Experimentally enable host usm allocation cache. Use X% of shared system memory.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUSMAllocationReuseVersion, -1, "Version of mechanism to use for usm allocation reuse.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalAdaptiveUsmPrefetch, -1, "Experimentally prefetch shared allocations frequently used by a kernel before its next launch, based on access history. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalBatchedUmdSharedMigration, -1, "Experimentally protect shared allocations moved to GPU domain with coalesced ranges and migrate allocations accessed together on CPU as a group. -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default threshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default threshold (in bytes) for D2H CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolSizeClasses, -1, "Experimentally serve clCreateBuffer under 4KB from per-thread size class caches of the small buffer pool. -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/program/printf_output_streamer.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 #include "shared/source/utilities/wait_util.h"
 
 namespace NEO {
@@ -50,6 +52,12 @@ ExecutionEnvironment::~ExecutionEnvironment() {
     if (directSubmissionController) {
         directSubmissionController->stopThread();
     }
+    if (cpuCopyEngine) {
+        cpuCopyEngine->stopThreads();
+    }
+    if (printfOutputStreamer) {
+        printfOutputStreamer->stopThread();
+    }
     if (memoryManager) {
         memoryManager->commonCleanup();
         for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
@@ -143,6 +151,35 @@ DirectSubmissionController *ExecutionEnvironment::initializeDirectSubmissionCont
     return directSubmissionController.get();
 }
 
+CpuCopyEngine *ExecutionEnvironment::initializeCpuCopyEngine() {
+    std::lock_guard<std::mutex> lockForInit(initializeCpuCopyEngineMutex);
+    if (CpuCopyEngine::isEnabled() && this->cpuCopyEngine == nullptr) {
+        this->cpuCopyEngine = std::make_unique<CpuCopyEngine>();
+        this->cpuCopyEngine->startThreads();
+    }
+    return cpuCopyEngine.get();
+}
+
+PrintfOutputStreamer *ExecutionEnvironment::initializePrintfOutputStreamer() {
+    std::lock_guard<std::mutex> lockForInit(initializePrintfOutputStreamerMutex);
+    if (PrintfOutputStreamer::isEnabled() && this->printfOutputStreamer == nullptr) {
+        this->printfOutputStreamer = std::make_unique<PrintfOutputStreamer>();
+        this->printfOutputStreamer->startThread();
+    }
+    return printfOutputStreamer.get();
+}
+
+void ExecutionEnvironment::drainPrintfOutput() {
+    PrintfOutputStreamer *streamer = nullptr;
+    {
+        std::lock_guard<std::mutex> lockForInit(initializePrintfOutputStreamerMutex);
+        streamer = this->printfOutputStreamer.get();
+    }
+    if (streamer) {
+        streamer->drain();
+    }
+}
+
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     if (rootDeviceEnvironments.size() < numRootDevices) {
         rootDeviceEnvironments.resize(numRootDevices);
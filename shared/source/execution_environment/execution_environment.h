@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,8 @@
 #include <vector>
 
 namespace NEO {
+class CpuCopyEngine;
+class PrintfOutputStreamer;
 class DirectSubmissionController;
 class GfxCoreHelper;
 class MemoryManager;
@@ -68,9 +70,14 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     bool isFP64EmulationEnabled() const { return fp64EmulationEnabled; }
 
     DirectSubmissionController *initializeDirectSubmissionController();
+    CpuCopyEngine *initializeCpuCopyEngine();
+    PrintfOutputStreamer *initializePrintfOutputStreamer();
+    void drainPrintfOutput();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::unique_ptr<CpuCopyEngine> cpuCopyEngine;
+    std::unique_ptr<PrintfOutputStreamer> printfOutputStreamer;
     std::unique_ptr<OsEnvironment> osEnvironment;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
@@ -95,6 +102,8 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     DebuggingMode debuggingEnabledMode = DebuggingMode::disabled;
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
     std::mutex initializeDirectSubmissionControllerMutex;
+    std::mutex initializeCpuCopyEngineMutex;
+    std::mutex initializePrintfOutputStreamerMutex;
     std::vector<std::tuple<std::string, uint32_t>> deviceCcsModeVec;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,9 @@
 #include <cstdint>
 
 namespace NEO {
+class DispatchTemplateCache;
 class GraphicsAllocation;
+class IndirectDataCache;
 struct ImplicitArgs;
 struct KernelDescriptor;
 
@@ -49,5 +51,8 @@ struct DispatchKernelEncoderI {
     virtual ImplicitArgs *getImplicitArgs() const = 0;
     virtual void patchBindlessOffsetsInCrossThreadData(uint64_t bindlessSurfaceStateBaseOffset) const = 0;
     virtual void patchSamplerBindlessOffsetsInCrossThreadData(uint64_t samplerStateOffset) const = 0;
+
+    virtual DispatchTemplateCache *getDispatchTemplateCache() const { return nullptr; }
+    virtual IndirectDataCache *getIndirectDataCache() const { return nullptr; }
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -245,7 +245,7 @@ struct KernelDescriptor {
     struct {
         std::string kernelName;
         std::string kernelLanguageAttributes;
-        StringMap printfStringsMap;
+        std::shared_ptr<StringMap> printfStringsMap = std::make_shared<StringMap>();
 
         uint16_t compiledSubGroupsNumber = 0U;
         uint8_t requiredSubGroupSize = 0U;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -205,7 +205,7 @@ void populateKernelDescriptor(KernelDescriptor &dst, const SPatchAllocateRTGloba
 void populateKernelDescriptor(KernelDescriptor &dst, const SPatchString &token) {
     uint32_t stringIndex = token.Index;
     const char *stringData = reinterpret_cast<const char *>(&token + 1);
-    dst.kernelMetadata.printfStringsMap[stringIndex].assign(stringData, stringData + token.StringSize);
+    (*dst.kernelMetadata.printfStringsMap)[stringIndex].assign(stringData, stringData + token.StringSize);
 }
 
 template <typename TokenT, typename... ArgsT>
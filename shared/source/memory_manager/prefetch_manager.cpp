@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,15 +7,35 @@
 
 #include "shared/source/memory_manager/prefetch_manager.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 std::unique_ptr<PrefetchManager> PrefetchManager::create() {
     return std::make_unique<PrefetchManager>();
 }
 
+PrefetchManager::~PrefetchManager() {
+    if (debugManager.flags.PrintAdaptiveUsmPrefetchStatistics.get()) {
+        auto stats = getStatistics();
+        PRINT_DEBUG_STRING(true, stdout, "Adaptive USM prefetch: predicted %llu, used %llu, unused %llu, skipped cpu bound %llu, cpu faults %llu\n",
+                           static_cast<unsigned long long>(stats.predictedAllocations),
+                           static_cast<unsigned long long>(stats.usedPredictions),
+                           static_cast<unsigned long long>(stats.unusedPredictions),
+                           static_cast<unsigned long long>(stats.skippedCpuBoundAllocations),
+                           static_cast<unsigned long long>(stats.cpuFaults));
+    }
+}
+
+bool PrefetchManager::isAdaptivePrefetchEnabled() {
+    return debugManager.flags.ExperimentalAdaptiveUsmPrefetch.get() == 1;
+}
+
 void PrefetchManager::insertAllocation(PrefetchContext &context, const void *usmPtr, SvmAllocationData &allocData) {
     std::unique_lock<SpinLock> lock{context.lock};
     if (allocData.memoryType == InternalMemoryType::sharedUnifiedMemory) {
@@ -25,7 +45,14 @@ void PrefetchManager::insertAllocation(PrefetchContext &context, const void *usm
 
 void PrefetchManager::migrateAllocationsToGpu(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr) {
     std::unique_lock<SpinLock> lock{context.lock};
-    for (auto &ptr : context.allocations) {
+    auto allocations = context.allocations;
+    for (auto usmPtr : recordKernelExecutions(context)) {
+        if (std::find(allocations.begin(), allocations.end(), usmPtr) == allocations.end()) {
+            allocations.push_back(usmPtr);
+        }
+    }
+
+    for (auto &ptr : allocations) {
         auto allocData = unifiedMemoryManager.getSVMAlloc(ptr);
         if (allocData) {
             unifiedMemoryManager.prefetchMemory(device, csr, *allocData);
@@ -36,6 +63,105 @@ void PrefetchManager::migrateAllocationsToGpu(PrefetchContext &context, SVMAlloc
 void PrefetchManager::removeAllocations(PrefetchContext &context) {
     std::unique_lock<SpinLock> lock{context.lock};
     context.allocations.clear();
+    context.kernelLaunches.clear();
+}
+
+void PrefetchManager::removeKernelLaunches(PrefetchContext &context) {
+    std::unique_lock<SpinLock> lock{context.lock};
+    context.kernelLaunches.clear();
+}
+
+void PrefetchManager::recordKernelLaunch(PrefetchContext &context, const KernelDescriptor &kernelDescriptor, const ResidencyContainer &kernelAllocations, SVMAllocsManager &unifiedMemoryManager) {
+    PrefetchKernelLaunch launch;
+    launch.kernelDescriptor = &kernelDescriptor;
+    for (auto allocation : kernelAllocations) {
+        if (allocation == nullptr) {
+            continue;
+        }
+        auto usmPtr = reinterpret_cast<const void *>(allocation->getGpuAddress());
+        auto allocData = unifiedMemoryManager.getSVMAlloc(usmPtr);
+        if (allocData && allocData->memoryType == InternalMemoryType::sharedUnifiedMemory) {
+            launch.sharedAllocations.push_back(usmPtr);
+        }
+    }
+    std::sort(launch.sharedAllocations.begin(), launch.sharedAllocations.end());
+    launch.sharedAllocations.erase(std::unique(launch.sharedAllocations.begin(), launch.sharedAllocations.end()), launch.sharedAllocations.end());
+
+    std::unique_lock<SpinLock> lock{context.lock};
+    context.kernelLaunches.push_back(std::move(launch));
+}
+
+// History is updated when the recorded launches are submitted, not when they are appended,
+// so a regular command list executed many times counts once per execution, same as CPU faults.
+std::vector<const void *> PrefetchManager::recordKernelExecutions(PrefetchContext &context) {
+    std::vector<const void *> hotAllocations;
+    std::unique_lock<std::mutex> lock{historyMtx};
+    for (const auto &launch : context.kernelLaunches) {
+        auto &history = kernelHistory[launch.kernelDescriptor];
+
+        for (const auto &[usmPtr, launchesUsingAllocation] : history.launchesUsingAllocation) {
+            if (launchesUsingAllocation * 2 < history.launchCount) {
+                continue;
+            }
+            if (isCpuBound(usmPtr)) {
+                statistics.skippedCpuBoundAllocations++;
+                continue;
+            }
+            statistics.predictedAllocations++;
+            if (std::binary_search(launch.sharedAllocations.begin(), launch.sharedAllocations.end(), usmPtr)) {
+                statistics.usedPredictions++;
+            } else {
+                statistics.unusedPredictions++;
+            }
+            if (std::find(hotAllocations.begin(), hotAllocations.end(), usmPtr) == hotAllocations.end()) {
+                hotAllocations.push_back(usmPtr);
+            }
+        }
+
+        history.launchCount++;
+        for (auto usmPtr : launch.sharedAllocations) {
+            history.launchesUsingAllocation[usmPtr]++;
+            allocationHistory[usmPtr].gpuLaunches++;
+        }
+    }
+    return hotAllocations;
+}
+
+void PrefetchManager::recordCpuFault(const void *usmPtr) {
+    std::unique_lock<std::mutex> lock{historyMtx};
+    statistics.cpuFaults++;
+    auto history = allocationHistory.find(usmPtr);
+    if (history != allocationHistory.end()) {
+        history->second.cpuFaults++;
+    }
+}
+
+void PrefetchManager::removeAllocationHistory(const void *usmPtr) {
+    std::unique_lock<std::mutex> lock{historyMtx};
+    if (allocationHistory.erase(usmPtr) == 0) {
+        return;
+    }
+    for (auto &[kernelDescriptor, history] : kernelHistory) {
+        history.launchesUsingAllocation.erase(usmPtr);
+    }
+}
+
+void PrefetchManager::removeKernelHistory(const KernelDescriptor &kernelDescriptor) {
+    std::unique_lock<std::mutex> lock{historyMtx};
+    kernelHistory.erase(&kernelDescriptor);
+}
+
+PrefetchStatistics PrefetchManager::getStatistics() {
+    std::unique_lock<std::mutex> lock{historyMtx};
+    return statistics;
+}
+
+bool PrefetchManager::isCpuBound(const void *usmPtr) const {
+    auto history = allocationHistory.find(usmPtr);
+    if (history == allocationHistory.end()) {
+        return false;
+    }
+    return history->second.cpuFaults * 2 > history->second.gpuLaunches;
 }
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,34 +8,81 @@
 #pragma once
 
 #include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
+struct KernelDescriptor;
 struct SvmAllocationData;
 
 class CommandStreamReceiver;
 class Device;
 class SVMAllocsManager;
 
+struct PrefetchKernelLaunch {
+    const KernelDescriptor *kernelDescriptor = nullptr;
+    std::vector<const void *> sharedAllocations;
+};
+
 struct PrefetchContext {
     std::vector<const void *> allocations;
+    std::vector<PrefetchKernelLaunch> kernelLaunches;
     SpinLock lock;
 };
 
+struct PrefetchStatistics {
+    uint64_t predictedAllocations = 0;
+    uint64_t usedPredictions = 0;
+    uint64_t unusedPredictions = 0;
+    uint64_t skippedCpuBoundAllocations = 0;
+    uint64_t cpuFaults = 0;
+};
+
 class PrefetchManager : public NonCopyableOrMovableClass {
   public:
     static std::unique_ptr<PrefetchManager> create();
 
-    virtual ~PrefetchManager() = default;
+    virtual ~PrefetchManager();
 
     void insertAllocation(PrefetchContext &context, const void *usmPtr, SvmAllocationData &allocData);
 
     MOCKABLE_VIRTUAL void migrateAllocationsToGpu(PrefetchContext &context, SVMAllocsManager &unifiedMemoryManager, Device &device, CommandStreamReceiver &csr);
 
     MOCKABLE_VIRTUAL void removeAllocations(PrefetchContext &context);
+    void removeKernelLaunches(PrefetchContext &context);
+
+    MOCKABLE_VIRTUAL void recordKernelLaunch(PrefetchContext &context, const KernelDescriptor &kernelDescriptor, const ResidencyContainer &kernelAllocations, SVMAllocsManager &unifiedMemoryManager);
+    std::vector<const void *> recordKernelExecutions(PrefetchContext &context);
+    void recordCpuFault(const void *usmPtr);
+    void removeAllocationHistory(const void *usmPtr);
+    void removeKernelHistory(const KernelDescriptor &kernelDescriptor);
+
+    PrefetchStatistics getStatistics();
+
+    static bool isAdaptivePrefetchEnabled();
+
+  protected:
+    struct AllocationAccessHistory {
+        uint32_t gpuLaunches = 0;
+        uint32_t cpuFaults = 0;
+    };
+
+    struct KernelAccessHistory {
+        std::unordered_map<const void *, uint32_t> launchesUsingAllocation;
+        uint32_t launchCount = 0;
+    };
+
+    bool isCpuBound(const void *usmPtr) const;
+
+    std::unordered_map<const KernelDescriptor *, KernelAccessHistory> kernelHistory;
+    std::unordered_map<const void *, AllocationAccessHistory> allocationHistory;
+    PrefetchStatistics statistics;
+    std::mutex historyMtx;
 };
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/compression_selector.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
@@ -551,6 +552,10 @@ void SVMAllocsManager::freeSVMAllocImpl(void *ptr, FreePolicyType policy, SvmAll
     if (svmData->cpuAllocation && pageFaultManager) {
         pageFaultManager->removeAllocation(svmData->cpuAllocation->getUnderlyingBuffer());
     }
+    auto prefetchManager = this->memoryManager->getPrefetchManager();
+    if (prefetchManager && svmData->memoryType == InternalMemoryType::sharedUnifiedMemory) {
+        prefetchManager->removeAllocationHistory(reinterpret_cast<const void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    }
     if (svmData->gpuAllocations.getAllocationType() == AllocationType::svmZeroCopy) {
         freeZeroCopySvmAllocation(svmData);
     } else {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -251,6 +251,8 @@ class SVMAllocsManager {
 
     bool submitIndirectAllocationsAsPack(CommandStreamReceiver &csr);
 
+    MemoryManager *getMemoryManager() const { return memoryManager; }
+
   protected:
     void *createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                       const RootDeviceIndicesContainer &rootDeviceIndices,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,7 @@
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/i915_prelim.h"
 #include "shared/source/os_interface/linux/memory_info.h"
+#include "shared/source/os_interface/linux/numa_library.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
 #include "shared/source/os_interface/os_interface.h"
@@ -450,12 +451,80 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignmentImpl(const A
     return drmAllocation;
 }
 
+bool DrmMemoryManager::isDeviceLocalNumaPlacementCandidate(const AllocationData &allocationData) {
+    auto placementMode = debugManager.flags.EnableDeviceLocalNumaPlacement.get();
+    if (placementMode <= 0) {
+        return false;
+    }
+    if (allocationData.flags.isUSMHostAllocation) {
+        return placementMode == 2;
+    }
+    switch (allocationData.type) {
+    case AllocationType::commandBuffer:
+    case AllocationType::ringBuffer:
+    case AllocationType::semaphoreBuffer:
+    case AllocationType::linearStream:
+    case AllocationType::internalHostMemory:
+    case AllocationType::tagBuffer:
+    case AllocationType::timestampPacketTagBuffer:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool DrmMemoryManager::bindToDeviceLocalNumaNode(const AllocationData &allocationData, void *cpuPtr, size_t size) {
+    if (!isDeviceLocalNumaPlacementCandidate(allocationData)) {
+        return false;
+    }
+    auto memoryInfo = getDrm(allocationData.rootDeviceIndex).getMemoryInfo();
+    if (!memoryInfo || !memoryInfo->getLocalNumaNode().has_value()) {
+        return false;
+    }
+    return Linux::NumaLibrary::bindMemoryToNode(cpuPtr, size, memoryInfo->getLocalNumaNode().value());
+}
+
+bool DrmMemoryManager::isHugePageBackingCandidate(const AllocationData &allocationData, size_t size) {
+    if (debugManager.flags.EnableHostAllocationHugePages.get() != 1) {
+        return false;
+    }
+    size_t threshold = 4 * MemoryConstants::megaByte;
+    if (debugManager.flags.HostAllocationHugePagesThreshold.get() != -1) {
+        threshold = static_cast<size_t>(debugManager.flags.HostAllocationHugePagesThreshold.get());
+    }
+    return size >= std::max(threshold, MemoryConstants::pageSize2M);
+}
+
+bool DrmMemoryManager::adviseHugePages(const AllocationData &allocationData, void *cpuPtr, size_t size) {
+    auto hugePagesPtr = alignUp(cpuPtr, MemoryConstants::pageSize2M);
+    auto hugePagesEnd = alignDown(ptrOffset(cpuPtr, size), MemoryConstants::pageSize2M);
+    size_t hugePagesSize = 0u;
+    if (hugePagesEnd > hugePagesPtr &&
+        SysCalls::madvise(hugePagesPtr, ptrDiff(hugePagesEnd, hugePagesPtr), MADV_HUGEPAGE) == 0) {
+        hugePagesSize = ptrDiff(hugePagesEnd, hugePagesPtr);
+    }
+    PRINT_DEBUG_STRING(debugManager.flags.PrintHostAllocationHugePages.get(), stdout,
+                       "Huge pages %s for allocation type %u, cpu ptr %p, size %zu, huge page backed size %zu\n",
+                       hugePagesSize ? "requested" : "not available", static_cast<uint32_t>(allocationData.type), cpuPtr, size, hugePagesSize);
+    return hugePagesSize != 0u;
+}
+
 DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSVMSize, uint64_t gpuAddress) {
+    auto useHugePages = isHugePageBackingCandidate(allocationData, size);
+    if (useHugePages) {
+        alignment = std::max(alignment, MemoryConstants::pageSize2M);
+    }
+
     auto res = alignedMallocWrapper(size, alignment);
     if (!res) {
         return nullptr;
     }
 
+    if (useHugePages) {
+        adviseHugePages(allocationData, res, size);
+    }
+    bindToDeviceLocalNumaNode(allocationData, res, size);
+
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(res), size, allocationData.rootDeviceIndex));
     if (!bo) {
         alignedFreeWrapper(res);
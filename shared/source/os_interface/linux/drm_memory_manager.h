@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -132,6 +132,10 @@ class DrmMemoryManager : public MemoryManager {
     MOCKABLE_VIRTUAL uint64_t acquireGpuRangeWithCustomAlignment(size_t &size, uint32_t rootDeviceIndex, HeapIndex heapIndex, size_t alignment);
     MOCKABLE_VIRTUAL void releaseGpuRange(void *address, size_t size, uint32_t rootDeviceIndex);
     void emitPinningRequest(BufferObject *bo, const AllocationData &allocationData) const;
+    static bool isDeviceLocalNumaPlacementCandidate(const AllocationData &allocationData);
+    MOCKABLE_VIRTUAL bool bindToDeviceLocalNumaNode(const AllocationData &allocationData, void *cpuPtr, size_t size);
+    static bool isHugePageBackingCandidate(const AllocationData &allocationData, size_t size);
+    MOCKABLE_VIRTUAL bool adviseHugePages(const AllocationData &allocationData, void *cpuPtr, size_t size);
     uint32_t getDefaultDrmContextId(uint32_t rootDeviceIndex) const;
     OsContextLinux *getDefaultOsContext(uint32_t rootDeviceIndex) const;
     size_t getUserptrAlignment();
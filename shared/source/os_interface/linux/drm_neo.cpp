@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -200,6 +200,32 @@ std::string Drm::getSysFsPciPath() {
     return {};
 }
 
+std::optional<uint32_t> Drm::getDeviceNumaNode() const {
+    if (debugManager.flags.OverrideDeviceNumaNode.get() != -1) {
+        return static_cast<uint32_t>(debugManager.flags.OverrideDeviceNumaNode.get());
+    }
+
+    std::string numaNodePath = std::string(Os::sysFsPciPathPrefix) + hwDeviceId->getPciPath() + "/numa_node";
+    int fd = SysCalls::open(numaNodePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+
+    std::array<char, 16> readString = {'\0'};
+    ssize_t bytesRead = SysCalls::pread(fd, readString.data(), readString.size() - 1, 0);
+    SysCalls::close(fd);
+    if (bytesRead <= 0) {
+        return std::nullopt;
+    }
+
+    char *endPtr = nullptr;
+    auto numaNode = std::strtol(readString.data(), &endPtr, 10);
+    if (endPtr == readString.data() || numaNode < 0) {
+        return std::nullopt;
+    }
+    return static_cast<uint32_t>(numaNode);
+}
+
 bool Drm::readSysFsAsString(const std::string &relativeFilePath, std::string &readString) {
 
     auto devicePath = getSysFsPciPath();
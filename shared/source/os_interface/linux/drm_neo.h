@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -83,6 +84,7 @@ class Drm : public DriverModel {
         return 0;
     }
     PhysicalDevicePciSpeedInfo getPciSpeedInfo() const override;
+    MOCKABLE_VIRTUAL std::optional<uint32_t> getDeviceNumaNode() const;
     int enableTurboBoost();
     int getEuTotal(int &euTotal);
     int getSubsliceTotal(int &subsliceTotal);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,18 @@ MemoryInfo::MemoryInfo(const RegionContainer &regionInfo, const Drm &inputDrm)
         memPolicySupported = Linux::NumaLibrary::init();
     }
     memPolicyMode = debugManager.flags.OverrideHostAllocationMemPolicyMode.get();
+
+    if (debugManager.flags.EnableDeviceLocalNumaPlacement.get() > 0 &&
+        (Linux::NumaLibrary::isLoaded() || Linux::NumaLibrary::init())) {
+        localNumaNode = drm.getDeviceNumaNode();
+        if (localNumaNode.has_value()) {
+            PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stdout, "Device-local NUMA node: %u\n", localNumaNode.value());
+        }
+    }
+}
+
+bool MemoryInfo::isUsmHostNumaPlacementEnabled() const {
+    return localNumaNode.has_value() && debugManager.flags.EnableDeviceLocalNumaPlacement.get() == 2;
 }
 
 void MemoryInfo::assignRegionsFromDistances(const std::vector<DistanceInfo> &distances) {
@@ -71,9 +83,14 @@ int MemoryInfo::createGemExt(const MemRegionsVec &memClassInstances, size_t allo
     int mode = -1;
     auto &productHelper = this->drm.getRootDeviceEnvironment().getHelper<ProductHelper>();
     auto isCoherent = productHelper.isCoherentAllocation(patIndex);
-    if (memPolicySupported &&
-        isUSMHostAllocation &&
-        Linux::NumaLibrary::getMemPolicy(&mode, memPolicyNodeMask)) {
+    if (isUSMHostAllocation &&
+        isUsmHostNumaPlacementEnabled() &&
+        Linux::NumaLibrary::getNodeMask(localNumaNode.value(), memPolicyNodeMask)) {
+        mode = (memPolicyMode != -1) ? memPolicyMode : Linux::NumaLibrary::mpolPreferred;
+        return this->drm.getIoctlHelper()->createGemExt(memClassInstances, allocSize, handle, patIndex, vmId, pairHandle, isChunked, numOfChunks, mode, memPolicyNodeMask, isCoherent);
+    } else if (memPolicySupported &&
+               isUSMHostAllocation &&
+               Linux::NumaLibrary::getMemPolicy(&mode, memPolicyNodeMask)) {
         if (memPolicyMode != -1) {
             mode = memPolicyMode;
         }
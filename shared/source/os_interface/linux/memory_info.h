@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 namespace NEO {
@@ -46,6 +47,8 @@ class MemoryInfo {
     const RegionContainer &getLocalMemoryRegions() const { return localMemoryRegions; }
     const RegionContainer &getDrmRegionInfos() const { return drmQueryRegions; }
     bool isMemPolicySupported() const { return memPolicySupported; }
+    std::optional<uint32_t> getLocalNumaNode() const { return localNumaNode; }
+    bool isUsmHostNumaPlacementEnabled() const;
 
   protected:
     const Drm &drm;
@@ -54,6 +57,7 @@ class MemoryInfo {
     const MemoryRegion &systemMemoryRegion;
     bool memPolicySupported;
     int memPolicyMode;
+    std::optional<uint32_t> localNumaNode;
     RegionContainer localMemoryRegions;
     std::array<uint32_t, 4> tileToLocalMemoryRegionIndexMap{};
 };
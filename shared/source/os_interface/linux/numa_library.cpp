@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@ std::unique_ptr<NEO::OsLibrary> NumaLibrary::osLibrary(nullptr);
 NumaLibrary::GetMemPolicyPtr NumaLibrary::getMemPolicyFunction(nullptr);
 NumaLibrary::NumaAvailablePtr NumaLibrary::numaAvailableFunction(nullptr);
 NumaLibrary::NumaMaxNodePtr NumaLibrary::numaMaxNodeFunction(nullptr);
+NumaLibrary::MbindPtr NumaLibrary::mbindFunction(nullptr);
 int NumaLibrary::maxNode(-1);
 bool NumaLibrary::numaLoaded(false);
 
@@ -28,11 +29,13 @@ bool NumaLibrary::init() {
     numaAvailableFunction = nullptr;
     numaMaxNodeFunction = nullptr;
     getMemPolicyFunction = nullptr;
+    mbindFunction = nullptr;
     if (osLibrary) {
         DEBUG_BREAK_IF(!osLibrary->isLoaded());
         numaAvailableFunction = reinterpret_cast<NumaAvailablePtr>(osLibrary->getProcAddress(std::string(procNumaAvailableStr)));
         numaMaxNodeFunction = reinterpret_cast<NumaMaxNodePtr>(osLibrary->getProcAddress(std::string(procNumaMaxNodeStr)));
         getMemPolicyFunction = reinterpret_cast<GetMemPolicyPtr>(osLibrary->getProcAddress(std::string(procGetMemPolicyStr)));
+        mbindFunction = reinterpret_cast<MbindPtr>(osLibrary->getProcAddress(std::string(procMbindStr)));
         if (numaAvailableFunction && numaMaxNodeFunction && getMemPolicyFunction) {
             if ((*numaAvailableFunction)() == 0) {
                 maxNode = (*numaMaxNodeFunction)();
@@ -52,5 +55,24 @@ bool NumaLibrary::getMemPolicy(int *mode, std::vector<unsigned long> &nodeMask)
     return false;
 }
 
+bool NumaLibrary::getNodeMask(uint32_t node, std::vector<unsigned long> &nodeMask) {
+    if (!numaLoaded || static_cast<int>(node) > maxNode) {
+        return false;
+    }
+    constexpr size_t bitsPerMaskEntry = sizeof(unsigned long) * 8;
+    std::vector<unsigned long>(maxNode + 1, 0).swap(nodeMask);
+    nodeMask[node / bitsPerMaskEntry] |= 1ul << (node % bitsPerMaskEntry);
+    return true;
+}
+
+bool NumaLibrary::bindMemoryToNode(void *ptr, size_t size, uint32_t node) {
+    std::vector<unsigned long> nodeMask;
+    if (!mbindFunction || !getNodeMask(node, nodeMask)) {
+        return false;
+    }
+    // kernel consumes maxnode - 1 bits of the mask
+    return (*mbindFunction)(ptr, size, mpolPreferred, nodeMask.data(), maxNode + 2, mpolMfMove) != -1;
+}
+
 } // namespace Linux
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,21 +21,29 @@ class NumaLibrary {
     static bool init();
     static bool isLoaded() { return numaLoaded; }
     static bool getMemPolicy(int *mode, std::vector<unsigned long> &nodeMask);
+    static bool getNodeMask(uint32_t node, std::vector<unsigned long> &nodeMask);
+    static bool bindMemoryToNode(void *ptr, size_t size, uint32_t node);
+
+    static constexpr int mpolPreferred = 1;
+    static constexpr unsigned int mpolMfMove = 1u << 1;
 
   protected:
     static constexpr const char *numaLibNameStr = "libnuma.so.1";
     static constexpr const char *procGetMemPolicyStr = "get_mempolicy";
     static constexpr const char *procNumaAvailableStr = "numa_available";
     static constexpr const char *procNumaMaxNodeStr = "numa_max_node";
+    static constexpr const char *procMbindStr = "mbind";
 
     using GetMemPolicyPtr = std::add_pointer<long(int *, unsigned long[], unsigned long, void *, unsigned long)>::type;
     using NumaAvailablePtr = std::add_pointer<int(void)>::type;
     using NumaMaxNodePtr = std::add_pointer<int(void)>::type;
+    using MbindPtr = std::add_pointer<long(void *, unsigned long, int, const unsigned long *, unsigned long, unsigned int)>::type;
 
     static std::unique_ptr<NEO::OsLibrary> osLibrary;
     static GetMemPolicyPtr getMemPolicyFunction;
     static NumaAvailablePtr numaAvailableFunction;
     static NumaMaxNodePtr numaMaxNodeFunction;
+    static MbindPtr mbindFunction;
     static int maxNode;
     static bool numaLoaded;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,14 +8,31 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include <algorithm>
 
 namespace NEO {
+PageFaultManager::~PageFaultManager() {
+    if (debugManager.flags.PrintUmdPageFaultStatistics.get()) {
+        auto stats = getStatistics();
+        PRINT_DEBUG_STRING(true, stdout, "UMD page faults: %llu, group migrations: %llu, protected ranges: %llu, coalesced protect calls: %llu\n",
+                           static_cast<unsigned long long>(stats.cpuFaults),
+                           static_cast<unsigned long long>(stats.groupMigrations),
+                           static_cast<unsigned long long>(stats.protectedRanges),
+                           static_cast<unsigned long long>(stats.coalescedProtectCalls));
+        for (size_t bucket = 0; bucket < PageFaultStatistics::latencyBucketsCount; bucket++) {
+            PRINT_DEBUG_STRING(true, stdout, "UMD page fault latency < %llu us: %llu\n", 1ull << (bucket + 1), static_cast<unsigned long long>(stats.faultLatencyHistogramUs[bucket]));
+        }
+    }
+}
+
 void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties) {
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::cpu : AllocationDomain::none;
@@ -51,7 +68,7 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
         if (pageFaultData.domain != AllocationDomain::gpu) {
-            this->migrateStorageToGpuDomain(ptr, pageFaultData);
+            this->migrateStorageToGpuDomain(ptr, pageFaultData, true);
 
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
@@ -63,14 +80,55 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
 
 void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto allocPtr : unifiedMemoryManager->nonGpuDomainAllocs) {
-        auto &pageFaultData = this->memoryData[allocPtr];
-        this->migrateStorageToGpuDomain(allocPtr, pageFaultData);
+    if (isBatchedDomainTransitionEnabled()) {
+        std::vector<std::pair<void *, size_t>> rangesToProtect;
+        rangesToProtect.reserve(unifiedMemoryManager->nonGpuDomainAllocs.size());
+        for (auto allocPtr : unifiedMemoryManager->nonGpuDomainAllocs) {
+            auto &pageFaultData = this->memoryData[allocPtr];
+            if (pageFaultData.domain == AllocationDomain::cpu) {
+                rangesToProtect.emplace_back(allocPtr, pageFaultData.size);
+            }
+            this->migrateStorageToGpuDomain(allocPtr, pageFaultData, false);
+        }
+        this->protectCPUMemoryAccessCoalesced(rangesToProtect);
+
+        this->previousCpuAccessGroup.swap(this->cpuAccessGroup);
+        this->cpuAccessGroup.clear();
+    } else {
+        for (auto allocPtr : unifiedMemoryManager->nonGpuDomainAllocs) {
+            auto &pageFaultData = this->memoryData[allocPtr];
+            this->migrateStorageToGpuDomain(allocPtr, pageFaultData, true);
+        }
     }
     unifiedMemoryManager->nonGpuDomainAllocs.clear();
 }
 
-inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+void PageFaultManager::protectCPUMemoryAccessCoalesced(std::vector<std::pair<void *, size_t>> &ranges) {
+    if (ranges.empty()) {
+        return;
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    auto rangeStart = ranges[0].first;
+    auto rangeEnd = ptrOffset(ranges[0].first, alignUp(ranges[0].second, MemoryConstants::pageSize));
+    for (size_t i = 1; i < ranges.size(); i++) {
+        auto nextStart = ranges[i].first;
+        auto nextEnd = ptrOffset(nextStart, alignUp(ranges[i].second, MemoryConstants::pageSize));
+        if (nextStart <= rangeEnd) {
+            rangeEnd = std::max(rangeEnd, nextEnd);
+            continue;
+        }
+        this->protectCPUMemoryAccess(rangeStart, ptrDiff(rangeEnd, rangeStart));
+        this->statistics.coalescedProtectCalls++;
+        rangeStart = nextStart;
+        rangeEnd = nextEnd;
+    }
+    this->protectCPUMemoryAccess(rangeStart, ptrDiff(rangeEnd, rangeStart));
+    this->statistics.coalescedProtectCalls++;
+    this->statistics.protectedRanges += ranges.size();
+}
+
+inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData, bool protectCpuAccess) {
     if (pageFaultData.domain == AllocationDomain::cpu) {
         this->setCpuAllocEvictable(false, ptr, pageFaultData.unifiedMemoryManager);
         this->allowCPUMemoryEviction(false, ptr, pageFaultData);
@@ -91,12 +149,15 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
 
         PRINT_DEBUG_STRING(debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
 
-        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        if (protectCpuAccess) {
+            this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+        }
     }
     pageFaultData.domain = AllocationDomain::gpu;
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
+    auto start = std::chrono::steady_clock::now();
     std::unique_lock<SpinLock> lock{mtx};
     for (auto &alloc : this->memoryData) {
         auto allocPtr = alloc.first;
@@ -104,12 +165,65 @@ bool PageFaultManager::verifyPageFault(void *ptr) {
         if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
             this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
             gpuDomainHandler(this, allocPtr, pageFaultData);
+            this->recordCpuFault(allocPtr, pageFaultData);
+            if (isBatchedDomainTransitionEnabled()) {
+                this->migrateCpuAccessGroup(allocPtr);
+            }
+            this->recordFaultLatency(start);
             return true;
         }
     }
     return false;
 }
 
+void PageFaultManager::recordCpuFault(void *ptr, PageFaultData &pageFaultData) {
+    if (!PrefetchManager::isAdaptivePrefetchEnabled()) {
+        return;
+    }
+    auto prefetchManager = pageFaultData.unifiedMemoryManager->getMemoryManager()->getPrefetchManager();
+    if (prefetchManager) {
+        prefetchManager->recordCpuFault(ptr);
+    }
+}
+
+void PageFaultManager::migrateCpuAccessGroup(void *faultedPtr) {
+    this->cpuAccessGroup.push_back(faultedPtr);
+
+    if (std::find(this->previousCpuAccessGroup.begin(), this->previousCpuAccessGroup.end(), faultedPtr) == this->previousCpuAccessGroup.end()) {
+        return;
+    }
+    for (auto groupPtr : this->previousCpuAccessGroup) {
+        auto alloc = this->memoryData.find(groupPtr);
+        if (groupPtr == faultedPtr || alloc == this->memoryData.end() || alloc->second.domain != AllocationDomain::gpu) {
+            continue;
+        }
+        this->setAubWritable(true, groupPtr, alloc->second.unifiedMemoryManager);
+        gpuDomainHandler(this, groupPtr, alloc->second);
+        this->cpuAccessGroup.push_back(groupPtr);
+    }
+    this->previousCpuAccessGroup.clear();
+    this->statistics.groupMigrations++;
+}
+
+void PageFaultManager::recordFaultLatency(std::chrono::steady_clock::time_point start) {
+    auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    size_t bucket = 0;
+    while (bucket + 1 < PageFaultStatistics::latencyBucketsCount && (1ll << (bucket + 1)) <= elapsedUs) {
+        bucket++;
+    }
+    this->statistics.cpuFaults++;
+    this->statistics.faultLatencyHistogramUs[bucket]++;
+}
+
+PageFaultManager::PageFaultStatistics PageFaultManager::getStatistics() {
+    std::unique_lock<SpinLock> lock{mtx};
+    return this->statistics;
+}
+
+bool PageFaultManager::isBatchedDomainTransitionEnabled() {
+    return debugManager.flags.ExperimentalBatchedUmdSharedMigration.get() == 1;
+}
+
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
     this->gpuDomainHandler = gpuHandlerFuncPtr;
 }
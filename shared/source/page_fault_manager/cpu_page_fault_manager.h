@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,11 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <array>
+#include <chrono>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct MemoryProperties;
@@ -25,7 +28,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
   public:
     static std::unique_ptr<PageFaultManager> create();
 
-    virtual ~PageFaultManager() = default;
+    virtual ~PageFaultManager();
 
     MOCKABLE_VIRTUAL void moveAllocationToGpuDomain(void *ptr);
     MOCKABLE_VIRTUAL void moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager);
@@ -45,6 +48,18 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         AllocationDomain domain;
     };
 
+    struct PageFaultStatistics {
+        static constexpr size_t latencyBucketsCount = 16;
+
+        uint64_t cpuFaults = 0;
+        uint64_t groupMigrations = 0;
+        uint64_t protectedRanges = 0;
+        uint64_t coalescedProtectCalls = 0;
+        std::array<uint64_t, latencyBucketsCount> faultLatencyHistogramUs = {};
+    };
+
+    PageFaultStatistics getStatistics();
+
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
 
     void setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr);
@@ -64,16 +79,24 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void setCpuAllocEvictable(bool evictable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
     MOCKABLE_VIRTUAL void allowCPUMemoryEviction(bool evict, void *ptr, PageFaultData &pageFaultData);
+    MOCKABLE_VIRTUAL void recordCpuFault(void *ptr, PageFaultData &pageFaultData);
 
     static void transferAndUnprotectMemory(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     static void unprotectAndTransferMemory(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     void selectGpuDomainHandler();
-    inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData, bool protectCpuAccess);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void migrateCpuAccessGroup(void *faultedPtr);
+    void protectCPUMemoryAccessCoalesced(std::vector<std::pair<void *, size_t>> &ranges);
+    void recordFaultLatency(std::chrono::steady_clock::time_point start);
+    static bool isBatchedDomainTransitionEnabled();
 
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
     std::unordered_map<void *, PageFaultData> memoryData;
+    std::vector<void *> cpuAccessGroup;
+    std::vector<void *> previousCpuAccessGroup;
+    PageFaultStatistics statistics;
     SpinLock mtx;
 };
 } // namespace NEO
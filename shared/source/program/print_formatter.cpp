@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/string.h"
 
+#include <cstring>
 #include <iostream>
 
 namespace NEO {
@@ -22,6 +23,8 @@ PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t print
       stringLiteralMap(stringLiteralMap) {
 
     output.reset(new char[maxSinglePrintStringLength]);
+    dataFormat.reset(new char[maxSinglePrintStringLength]);
+    tokenFormat.reset(new char[tokenFormatSize]);
 }
 
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
@@ -59,7 +62,6 @@ void PrintFormatter::printString(const char *formatString, const std::function<v
     size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
 
     size_t cursor = 0;
-    std::unique_ptr<char[]> dataFormat(new char[length + 1]);
 
     for (size_t i = 0; i <= length; i++) {
         if (formatString[i] == '\\')
@@ -75,7 +77,7 @@ void PrintFormatter::printString(const char *formatString, const std::function<v
             while (isConversionSpecifier(formatString[end++]) == false && end < length)
                 ;
 
-            memcpy_s(dataFormat.get(), length, formatString + i, end - i);
+            memcpy_s(dataFormat.get(), maxSinglePrintStringLength, formatString + i, end - i);
             dataFormat[end - i] = '\0';
 
             if (formatString[end - 1] == 's')
@@ -118,17 +120,24 @@ void PrintFormatter::stripVectorTypeConversion(char *format) {
     }
 }
 
+char *PrintFormatter::copyTokenFormat(const char *inputFormatString) {
+    // one character is left for the length modifier inserted by adjustFormatString
+    strncpy_s(tokenFormat.get(), tokenFormatSize, inputFormatString, strnlen_s(inputFormatString, tokenFormatSize - 2));
+    return tokenFormat.get();
+}
+
 template <>
-void PrintFormatter::adjustFormatString<int64_t>(std::string &formatString) {
-    auto longPosition = formatString.find('l');
+void PrintFormatter::adjustFormatString<int64_t>(char *formatString, size_t size) {
+    auto longPosition = strchr(formatString, 'l');
 
-    if (longPosition == std::string::npos) {
+    if (longPosition == nullptr) {
         return;
     }
-    UNRECOVERABLE_IF(formatString.size() - 1 == longPosition);
+    UNRECOVERABLE_IF(longPosition[1] == '\0');
 
-    if (formatString.at(longPosition + 1) != 'l') {
-        formatString.insert(longPosition, "l");
+    const auto length = strlen(formatString);
+    if (longPosition[1] != 'l' && length + 1 < size) {
+        memmove(longPosition + 1, longPosition, length - (longPosition - formatString) + 1);
     }
 }
 
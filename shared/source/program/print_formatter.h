@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,7 @@ class PrintFormatter {
         initialOffset = offset;
     }
     constexpr static size_t maxSinglePrintStringLength = 16 * MemoryConstants::kiloByte;
+    constexpr static size_t tokenFormatSize = maxSinglePrintStringLength + 1;
 
   protected:
     const char *queryPrintfString(uint32_t index) const;
@@ -83,16 +84,18 @@ class PrintFormatter {
     }
 
     template <class T>
-    void adjustFormatString(std::string &formatString) {}
+    void adjustFormatString(char *formatString, size_t size) {}
+
+    char *copyTokenFormat(const char *inputFormatString);
 
     template <class T>
     size_t typedPrintToken(char *output, size_t size, const char *inputFormatString) {
         T value{0};
         read(&value);
         currentOffset = alignUp(currentOffset, sizeof(uint32_t));
-        std::string formatString(inputFormatString);
-        adjustFormatString<T>(formatString);
-        return simpleSprintf(output, size, formatString.c_str(), value);
+        auto formatString = copyTokenFormat(inputFormatString);
+        adjustFormatString<T>(formatString, tokenFormatSize);
+        return simpleSprintf(output, size, formatString, value);
     }
 
     template <class T>
@@ -106,12 +109,11 @@ class PrintFormatter {
 
         stripVectorFormat(inputFormatString, strippedFormat);
         stripVectorTypeConversion(strippedFormat);
-        std::string formatString(strippedFormat);
-        adjustFormatString<T>(formatString);
+        adjustFormatString<T>(strippedFormat, sizeof(strippedFormat));
 
         for (int i = 0; i < valueCount; i++) {
             read(&value);
-            charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, formatString.c_str(), value);
+            charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, strippedFormat, value);
             if (i < valueCount - 1) {
                 charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, "%c", ',');
             }
@@ -125,6 +127,8 @@ class PrintFormatter {
     }
 
     std::unique_ptr<char[]> output;
+    std::unique_ptr<char[]> dataFormat;  // conversion specification currently being printed
+    std::unique_ptr<char[]> tokenFormat; // copy of dataFormat adjusted for the host printf
 
     const uint8_t *printfOutputBuffer = nullptr; // buffer extracted from the kernel, contains values to be printed
     uint32_t printfOutputBufferSize = 0;         // size of the data contained in the buffer
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/printf_output_streamer.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+bool PrintfOutputStreamer::isEnabled() {
+    return debugManager.flags.EnableAsyncPrintf.get() == 1;
+}
+
+PrintfOutputStreamer::PrintfOutputStreamer() = default;
+
+PrintfOutputStreamer::~PrintfOutputStreamer() {
+    stopThread();
+}
+
+void PrintfOutputStreamer::startThread() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (worker) {
+        return;
+    }
+    keepRunning = true;
+    worker = Thread::createFunc(workerThreadFunc, reinterpret_cast<void *>(this));
+}
+
+void PrintfOutputStreamer::stopThread() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        keepRunning = false;
+    }
+    jobAvailable.notify_all();
+    if (worker) {
+        worker->join();
+        worker.reset();
+    }
+}
+
+void *PrintfOutputStreamer::workerThreadFunc(void *self) {
+    auto streamer = reinterpret_cast<PrintfOutputStreamer *>(self);
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(streamer->mutex);
+            streamer->jobAvailable.wait(lock, [&] { return !streamer->keepRunning || !streamer->jobs.empty(); });
+            // pending output is flushed before the thread exits
+            if (streamer->jobs.empty()) {
+                return nullptr;
+            }
+            job = std::move(streamer->jobs.front());
+            streamer->jobs.pop_front();
+            streamer->decoding = true;
+        }
+
+        streamer->decode(job);
+        streamer->recycle(std::move(job.snapshot));
+        job.stringLiteralMap.reset();
+
+        {
+            std::lock_guard<std::mutex> lock(streamer->mutex);
+            streamer->decoding = false;
+        }
+        streamer->jobDone.notify_all();
+    }
+}
+
+void PrintfOutputStreamer::submit(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferSize, bool using32BitPointers, std::shared_ptr<const StringMap> stringLiteralMap) {
+    if (printfOutputBufferSize < sizeof(uint32_t)) {
+        return;
+    }
+    // first 4 bytes of the buffer store the size of data written by the kernel, only that part is copied
+    uint32_t usedSize = 0;
+    memcpy_s(&usedSize, sizeof(usedSize), printfOutputBuffer, sizeof(usedSize));
+    usedSize = std::min(usedSize, printfOutputBufferSize);
+
+    Job job;
+    job.using32BitPointers = using32BitPointers;
+    job.stringLiteralMap = std::move(stringLiteralMap);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!spareSnapshots.empty()) {
+        job.snapshot = std::move(spareSnapshots.back());
+        spareSnapshots.pop_back();
+    }
+    job.snapshot.assign(printfOutputBuffer, printfOutputBuffer + usedSize);
+
+    if (!worker) {
+        lock.unlock();
+        decode(job);
+        recycle(std::move(job.snapshot));
+        return;
+    }
+    jobs.push_back(std::move(job));
+    lock.unlock();
+    jobAvailable.notify_one();
+}
+
+void PrintfOutputStreamer::drain() {
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [&] { return jobs.empty() && !decoding; });
+}
+
+void PrintfOutputStreamer::setSink(Sink newSink) {
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    sink = std::move(newSink);
+}
+
+size_t PrintfOutputStreamer::getPendingCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs.size() + (decoding ? 1u : 0u);
+}
+
+size_t PrintfOutputStreamer::getSpareSnapshotCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return spareSnapshots.size();
+}
+
+void PrintfOutputStreamer::decode(Job &job) {
+    PrintFormatter printFormatter(job.snapshot.data(), static_cast<uint32_t>(job.snapshot.size()), job.using32BitPointers, job.stringLiteralMap.get());
+
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    printFormatter.printKernelOutput(sink);
+}
+
+void PrintfOutputStreamer::recycle(std::vector<uint8_t> &&snapshot) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (spareSnapshots.size() < maxSpareSnapshots) {
+        spareSnapshots.push_back(std::move(snapshot));
+    }
+}
+
+} // namespace NEO
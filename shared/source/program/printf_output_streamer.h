@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/program/print_formatter.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Decodes printf buffers on a background thread. The completion path copies the used part of the printf surface into
+// a host snapshot and hands it over, so the surface can be reset and reused right away. Snapshots are decoded in
+// submission order and the output is streamed to the sink; decoded snapshot buffers are recycled. String literal maps
+// are shared with the kernel descriptor, so kernels may be released before their output is decoded. Host synchronization
+// points call drain(), so output is complete when they return.
+class PrintfOutputStreamer : NonCopyableOrMovableClass {
+  public:
+    using Sink = std::function<void(char *)>;
+    static constexpr size_t maxSpareSnapshots = 2u;
+
+    static bool isEnabled();
+
+    PrintfOutputStreamer();
+    MOCKABLE_VIRTUAL ~PrintfOutputStreamer();
+
+    void startThread();
+    void stopThread();
+
+    void submit(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferSize, bool using32BitPointers, std::shared_ptr<const StringMap> stringLiteralMap);
+    MOCKABLE_VIRTUAL void drain();
+    void setSink(Sink newSink);
+
+    size_t getPendingCount();
+    size_t getSpareSnapshotCount();
+    bool isThreadRunning() const { return worker != nullptr; }
+
+  protected:
+    struct Job {
+        std::vector<uint8_t> snapshot;
+        std::shared_ptr<const StringMap> stringLiteralMap;
+        bool using32BitPointers = false;
+    };
+
+    static void *workerThreadFunc(void *self);
+    void decode(Job &job);
+    void recycle(std::vector<uint8_t> &&snapshot);
+
+    std::unique_ptr<Thread> worker;
+    std::mutex mutex;
+    std::mutex sinkMutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobDone;
+    std::deque<Job> jobs;
+    std::vector<std::vector<uint8_t>> spareSnapshots;
+    Sink sink = [](char *str) { printToStdout(str); };
+    bool decoding = false;
+    bool keepRunning = false;
+};
+
+} // namespace NEO
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy_engine.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace NEO {
+
+bool CpuCopyEngine::isEnabled() {
+    return debugManager.flags.EnableParallelCpuCopy.get() == 1;
+}
+
+CpuCopyEngine::CpuCopyEngine() {
+    const auto hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    requestedWorkerCount = std::min(hardwareThreads - 1, maxDefaultWorkerCount);
+    if (debugManager.flags.ParallelCpuCopyWorkerCount.get() != -1) {
+        requestedWorkerCount = static_cast<uint32_t>(debugManager.flags.ParallelCpuCopyWorkerCount.get());
+    }
+    if (debugManager.flags.ParallelCpuCopyThreshold.get() != -1) {
+        parallelThreshold = static_cast<size_t>(debugManager.flags.ParallelCpuCopyThreshold.get());
+    }
+    if (debugManager.flags.CpuCopyStreamingStoresThreshold.get() != -1) {
+        streamingStoresThreshold = static_cast<size_t>(debugManager.flags.CpuCopyStreamingStoresThreshold.get());
+    }
+}
+
+CpuCopyEngine::~CpuCopyEngine() {
+    stopThreads();
+}
+
+void CpuCopyEngine::startThreads() {
+    std::lock_guard<std::mutex> submitLock(submitMutex);
+    if (!workers.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        keepRunning = true;
+    }
+    for (uint32_t i = 0; i < requestedWorkerCount; i++) {
+        auto worker = Thread::createFunc(workerThreadFunc, reinterpret_cast<void *>(this));
+        if (worker == nullptr) {
+            break;
+        }
+        workers.push_back(std::move(worker));
+    }
+}
+
+void CpuCopyEngine::stopThreads() {
+    std::lock_guard<std::mutex> submitLock(submitMutex);
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        keepRunning = false;
+    }
+    jobAvailable.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+    workers.clear();
+}
+
+void *CpuCopyEngine::workerThreadFunc(void *self) {
+    auto engine = reinterpret_cast<CpuCopyEngine *>(self);
+    uint64_t lastGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(engine->jobMutex);
+            engine->jobAvailable.wait(lock, [&] { return !engine->keepRunning || engine->jobGeneration != lastGeneration; });
+            if (!engine->keepRunning) {
+                return nullptr;
+            }
+            lastGeneration = engine->jobGeneration;
+            engine->activeWorkers++;
+        }
+
+        engine->copySlices();
+
+        {
+            std::lock_guard<std::mutex> lock(engine->jobMutex);
+            engine->activeWorkers--;
+        }
+        engine->jobDone.notify_all();
+    }
+}
+
+void CpuCopyEngine::copy(void *dst, const void *src, size_t size, bool writeCombinedDestination) {
+    const bool streamingStores = writeCombinedDestination && size >= streamingStoresThreshold;
+    if (size < parallelThreshold || workers.empty()) {
+        copySlice(static_cast<char *>(dst), static_cast<const char *>(src), size, streamingStores);
+        if (streamingStores) {
+            CpuIntrinsics::sfence();
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(submitMutex);
+    {
+        std::unique_lock<std::mutex> lock(jobMutex);
+        // a worker woken late for the previous job may still be reading its description
+        jobDone.wait(lock, [&] { return activeWorkers == 0; });
+
+        const auto participants = workers.size() + 1;
+        jobDst = static_cast<char *>(dst);
+        jobSrc = static_cast<const char *>(src);
+        jobSize = size;
+        jobSliceSize = std::max(alignUp((size + participants - 1) / participants, MemoryConstants::pageSize), minSliceSize);
+        jobSliceCount = (size + jobSliceSize - 1) / jobSliceSize;
+        jobStreamingStores = streamingStores;
+        nextSlice = 0;
+        jobGeneration++;
+    }
+    jobAvailable.notify_all();
+    parallelCopiesCount++;
+
+    copySlices();
+
+    std::unique_lock<std::mutex> lock(jobMutex);
+    jobDone.wait(lock, [&] { return activeWorkers == 0; });
+}
+
+void CpuCopyEngine::copySlices() {
+    bool copied = false;
+    for (auto slice = nextSlice.fetch_add(1); slice < jobSliceCount; slice = nextSlice.fetch_add(1)) {
+        const auto offset = slice * jobSliceSize;
+        copySlice(jobDst + offset, jobSrc + offset, std::min(jobSliceSize, jobSize - offset), jobStreamingStores);
+        copied = true;
+    }
+    if (copied && jobStreamingStores) {
+        CpuIntrinsics::sfence();
+    }
+}
+
+void CpuCopyEngine::copySlice(char *dst, const char *src, size_t size, bool streamingStores) {
+    if (streamingStores) {
+        CpuIntrinsics::streamingCopy(dst, src, size);
+    } else {
+        memcpy(dst, src, size);
+    }
+}
+
+} // namespace NEO
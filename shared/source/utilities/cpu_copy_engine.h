@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Host side copy engine for CPU transfer paths. Copies above the parallel threshold are split into contiguous,
+// page aligned slices, copied by a persistent pool of worker threads together with the calling thread. Each page
+// is touched by one thread only, which keeps first-touch placement local on NUMA systems. Destinations that are
+// write-combined or locked device memory are written with streaming stores.
+class CpuCopyEngine : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultParallelThreshold = 2 * MemoryConstants::megaByte;
+    static constexpr size_t defaultStreamingStoresThreshold = 256 * MemoryConstants::kiloByte;
+    static constexpr size_t minSliceSize = 512 * MemoryConstants::kiloByte;
+    static constexpr uint32_t maxDefaultWorkerCount = 7u;
+
+    static bool isEnabled();
+
+    CpuCopyEngine();
+    MOCKABLE_VIRTUAL ~CpuCopyEngine();
+
+    void startThreads();
+    void stopThreads();
+
+    void copy(void *dst, const void *src, size_t size, bool writeCombinedDestination);
+
+    size_t getWorkerCount() const { return workers.size(); }
+    size_t getParallelThreshold() const { return parallelThreshold; }
+    size_t getStreamingStoresThreshold() const { return streamingStoresThreshold; }
+    uint64_t getParallelCopiesCount() const { return parallelCopiesCount.load(); }
+
+  protected:
+    static void *workerThreadFunc(void *self);
+    void copySlices();
+    static void copySlice(char *dst, const char *src, size_t size, bool streamingStores);
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    uint32_t requestedWorkerCount = 0;
+    size_t parallelThreshold = defaultParallelThreshold;
+    size_t streamingStoresThreshold = defaultStreamingStoresThreshold;
+
+    std::mutex submitMutex;
+    std::mutex jobMutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobDone;
+    uint64_t jobGeneration = 0;
+    uint32_t activeWorkers = 0;
+    bool keepRunning = false;
+
+    char *jobDst = nullptr;
+    const char *jobSrc = nullptr;
+    size_t jobSize = 0;
+    size_t jobSliceSize = 0;
+    size_t jobSliceCount = 0;
+    bool jobStreamingStores = false;
+    std::atomic<size_t> nextSlice{0};
+
+    std::atomic<uint64_t> parallelCopiesCount{0};
+};
+
+} // namespace NEO
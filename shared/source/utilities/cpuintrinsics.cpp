@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,9 @@
 
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <algorithm>
+#include <cstring>
+
 #if defined(_WIN32)
 #include <immintrin.h>
 #include <intrin.h>
@@ -63,5 +66,37 @@ uint64_t rdtsc() {
     return __rdtsc();
 }
 
+void streamingCopy(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<char *>(dst);
+    auto srcBytes = static_cast<const char *>(src);
+
+    const size_t misalignment = reinterpret_cast<uintptr_t>(dstBytes) & (sizeof(__m128i) - 1);
+    if (misalignment != 0) {
+        const size_t head = std::min(size, sizeof(__m128i) - misalignment);
+        memcpy(dstBytes, srcBytes, head);
+        dstBytes += head;
+        srcBytes += head;
+        size -= head;
+    }
+
+    constexpr size_t blockSize = 4 * sizeof(__m128i);
+    for (; size >= blockSize; size -= blockSize, dstBytes += blockSize, srcBytes += blockSize) {
+        auto srcBlock = reinterpret_cast<const __m128i *>(srcBytes);
+        auto dstBlock = reinterpret_cast<__m128i *>(dstBytes);
+        const auto value0 = _mm_loadu_si128(srcBlock);
+        const auto value1 = _mm_loadu_si128(srcBlock + 1);
+        const auto value2 = _mm_loadu_si128(srcBlock + 2);
+        const auto value3 = _mm_loadu_si128(srcBlock + 3);
+        _mm_stream_si128(dstBlock, value0);
+        _mm_stream_si128(dstBlock + 1, value1);
+        _mm_stream_si128(dstBlock + 2, value2);
+        _mm_stream_si128(dstBlock + 3, value3);
+    }
+
+    if (size > 0) {
+        memcpy(dstBytes, srcBytes, size);
+    }
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
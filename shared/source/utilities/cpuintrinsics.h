@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace NEO {
@@ -26,5 +27,7 @@ void umonitor(void *a);
 
 uint64_t rdtsc();
 
+void streamingCopy(void *dst, const void *src, size_t size);
+
 } // namespace CpuIntrinsics
 } // namespace NEO
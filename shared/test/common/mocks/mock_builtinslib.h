@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,11 +8,25 @@
 #pragma once
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/compiler_interface/compiler_cache.h"
+
+#include <memory>
 
 using namespace NEO;
 class MockBuiltinsLib : BuiltinsLib {
   public:
     using BuiltinsLib::allStorages;
+    using BuiltinsLib::cacheBinary;
     using BuiltinsLib::getBuiltinCode;
     using BuiltinsLib::getBuiltinResource;
+    using BuiltinsLib::loadCachedBinary;
+
+    CompilerCache *getBinaryCache() override {
+        if (mockBinaryCache) {
+            return mockBinaryCache.get();
+        }
+        return BuiltinsLib::getBinaryCache();
+    }
+
+    std::unique_ptr<CompilerCache> mockBinaryCache;
 };
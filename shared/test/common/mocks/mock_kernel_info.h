@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,7 +53,7 @@ class MockKernelInfo : public KernelInfo {
 
     inline void addToPrintfStringsMap(uint32_t index, const std::string &string) {
         kernelDescriptor.kernelAttributes.flags.usesStringMapForPrintf = true;
-        kernelDescriptor.kernelMetadata.printfStringsMap.insert(std::make_pair(index, string));
+        kernelDescriptor.kernelMetadata.printfStringsMap->insert(std::make_pair(index, string));
     }
     void setPrintfSurface(uint8_t dataParamSize = sizeof(uintptr_t), CrossThreadDataOffset crossThreadDataOffset = undefined<CrossThreadDataOffset>, SurfaceStateHeapOffset sshOffset = undefined<SurfaceStateHeapOffset>);
     void setBindingTable(SurfaceStateHeapOffset tableOffset, uint8_t numEntries);
@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/program/printf_output_streamer.h"
+
+namespace NEO {
+class MockPrintfOutputStreamer : public PrintfOutputStreamer {
+  public:
+    void drain() override {
+        drainCalled++;
+        PrintfOutputStreamer::drain();
+    }
+
+    uint32_t drainCalled = 0u;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,7 @@ extern DIR *(*sysCallsOpendir)(const char *name);
 extern struct dirent *(*sysCallsReaddir)(DIR *dir);
 extern int (*sysCallsClosedir)(DIR *dir);
 extern int (*sysCallsGetDevicePath)(int deviceFd, char *buf, size_t &bufSize);
+extern int (*sysCallsMadvise)(void *addr, size_t size, int advice);
 extern int (*sysCallsClose)(int fileDescriptor);
 
 extern bool allowFakeDevicePath;
@@ -81,6 +82,7 @@ extern bool mmapCaptureExtendedPointers;
 extern bool mmapAllowExtendedPointers;
 extern uint32_t mmapFuncCalled;
 extern uint32_t munmapFuncCalled;
+extern uint32_t madviseFuncCalled;
 
 extern off_t lseekReturn;
 extern std::atomic<int> lseekCalledCount;
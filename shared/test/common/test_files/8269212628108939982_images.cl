@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,21 @@ __kernel void CopyBufferToBufferMiddle(
     vstore4(loaded, gid, pDst);
 }
 
+__kernel void CopyBufferToBufferMiddleWide(
+    const __global uint* pSrc,
+    __global uint* pDst,
+    uint srcOffsetInBytes,
+    uint dstOffsetInBytes)
+{
+    ALIGNED4(pSrc);
+    ALIGNED4(pDst);
+    unsigned int gid = get_global_id(0);
+    pDst += dstOffsetInBytes >> 2;
+    pSrc += srcOffsetInBytes >> 2;
+    uint8 loaded = vload8(gid, pSrc);
+    vstore8(loaded, gid, pDst);
+}
+
 __kernel void CopyBufferToBufferMiddleMisaligned(
     __global const uint* pSrc,
      __global uint* pDst,
@@ -132,6 +147,25 @@ __kernel void CopyBufferToBufferMiddleRegion(
     }
 }
 
+__kernel void CopyBufferToBufferMiddleRegionWide(
+    __global uint* pDst,
+    const __global uint* pSrc,
+    unsigned int elems,
+    uint dstSshOffset, // Offset needed in case ptr has been adjusted for SSH alignment
+    uint srcSshOffset // Offset needed in case ptr has been adjusted for SSH alignment
+    )
+{
+    ALIGNED4(pSrc);
+    ALIGNED4(pDst);
+    unsigned int gid = get_global_id(0);
+    __global uint* pDstWithOffset = (__global uint*)((__global uchar*)pDst + dstSshOffset);
+    __global uint* pSrcWithOffset = (__global uint*)((__global uchar*)pSrc + srcSshOffset);
+    if (gid < elems) {
+        uint8 loaded = vload8(gid, pSrcWithOffset);
+        vstore8(loaded, gid, pDstWithOffset);
+    }
+}
+
 #define ALIGNED4(ptr) __builtin_assume(((size_t)ptr&0b11) == 0)
 
 // assumption is local work size = pattern size
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,6 +46,19 @@ __kernel void CopyBufferToBufferMiddleStateless(
     vstore4(loaded, gid, pDst);
 }
 
+__kernel void CopyBufferToBufferMiddleWideStateless(
+    const __global uint* pSrc,
+    __global uint* pDst,
+    ulong srcOffsetInBytes,
+    ulong dstOffsetInBytes)
+{
+    size_t gid = get_global_id(0);
+    pDst += dstOffsetInBytes >> 2;
+    pSrc += srcOffsetInBytes >> 2;
+    uint8 loaded = vload8(gid, pSrc);
+    vstore8(loaded, gid, pDst);
+}
+
 __kernel void CopyBufferToBufferMiddleMisalignedStateless(
     __global const uint* pSrc,
      __global uint* pDst,
@@ -114,6 +127,23 @@ __kernel void CopyBufferToBufferMiddleRegionStateless(
     }
 }
 
+__kernel void CopyBufferToBufferMiddleRegionWideStateless(
+    __global uint* pDst,
+    const __global uint* pSrc,
+    ulong elems,
+    ulong dstSshOffset, // Offset needed in case ptr has been adjusted for SSH alignment
+    ulong srcSshOffset // Offset needed in case ptr has been adjusted for SSH alignment
+    )
+{
+    size_t gid = get_global_id(0);
+    __global uint* pDstWithOffset = (__global uint*)((__global uchar*)pDst + dstSshOffset);
+    __global uint* pSrcWithOffset = (__global uint*)((__global uchar*)pSrc + srcSshOffset);
+    if (gid < elems) {
+        uint8 loaded = vload8(gid, pSrcWithOffset);
+        vstore8(loaded, gid, pDstWithOffset);
+    }
+}
+
 // assumption is local work size = pattern size
 __kernel void FillBufferBytesStateless(
     __global uchar* pDst,
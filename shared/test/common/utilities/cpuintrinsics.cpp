@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 
 namespace CpuIntrinsicsTests {
@@ -30,6 +31,8 @@ std::atomic<uint32_t> umonitorCounter(0u);
 
 std::atomic<uint32_t> rdtscCounter(0u);
 
+std::atomic<uint32_t> streamingCopyCounter(0u);
+
 volatile TagAddressType *pauseAddress = nullptr;
 TaskCountType pauseValue = 0u;
 uint32_t pauseOffset = 0u;
@@ -90,5 +93,10 @@ uint64_t rdtsc() {
     return CpuIntrinsicsTests::rdtscRetValue;
 }
 
+void streamingCopy(void *dst, const void *src, size_t size) {
+    CpuIntrinsicsTests::streamingCopyCounter++;
+    memcpy(dst, src, size);
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,8 @@
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_builtinslib.h"
+#include "shared/test/common/mocks/mock_compiler_cache.h"
+#include "shared/test/common/mocks/mock_compiler_interface.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -136,6 +138,79 @@ HWTEST_F(BuiltInSharedTest, GivenValidBuiltinTypeAndAnyTypeWhenGettingBuiltinCod
     EXPECT_NE(0U, builtinCode.resource.size());
 }
 
+TEST_F(BuiltInSharedTest, givenBinaryCacheWhenLoadingCachedBinaryForIntermediateBuiltinThenBinaryIsReturnedOnlyAfterItWasCachedWithSameOptions) {
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->compilerInterface.reset(new MockCompilerInterface());
+    auto builtinsLib = std::make_unique<MockBuiltinsLib>();
+    auto compilerCache = new CompilerCacheMock();
+    builtinsLib->mockBinaryCache.reset(compilerCache);
+
+    auto builtinCode = builtinsLib->getBuiltinCode(EBuiltInOps::copyBufferToBuffer, BuiltinCode::ECodeType::intermediate, *pDevice);
+    ASSERT_NE(0u, builtinCode.resource.size());
+
+    auto cacheKey = builtinsLib->loadCachedBinary(builtinCode, "-options", "-internal-options");
+    EXPECT_FALSE(cacheKey.empty());
+    EXPECT_EQ(BuiltinCode::ECodeType::intermediate, builtinCode.type);
+
+    const char binary[] = "builtin binary";
+    builtinsLib->cacheBinary(cacheKey, binary, sizeof(binary));
+    EXPECT_EQ(1u, compilerCache->cacheInvoked);
+
+    auto otherOptionsCacheKey = builtinsLib->loadCachedBinary(builtinCode, "-other-options", "-internal-options");
+    EXPECT_NE(cacheKey, otherOptionsCacheKey);
+    EXPECT_EQ(BuiltinCode::ECodeType::intermediate, builtinCode.type);
+
+    EXPECT_TRUE(builtinsLib->loadCachedBinary(builtinCode, "-options", "-internal-options").empty());
+    EXPECT_EQ(BuiltinCode::ECodeType::binary, builtinCode.type);
+    EXPECT_EQ(BuiltinResourceT(binary, binary + sizeof(binary)), builtinCode.resource);
+
+    EXPECT_TRUE(builtinsLib->loadCachedBinary(builtinCode, "-options", "-internal-options").empty());
+    builtinsLib->cacheBinary("", binary, sizeof(binary));
+    EXPECT_EQ(1u, compilerCache->cacheInvoked);
+}
+
+TEST_F(BuiltInSharedTest, givenBinaryCacheWhenInternalOptionsOrCompilerChangeThenBuiltinCacheKeyChanges) {
+    auto compilerInterface = new MockCompilerInterface();
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->compilerInterface.reset(compilerInterface);
+    auto builtinsLib = std::make_unique<MockBuiltinsLib>();
+    builtinsLib->mockBinaryCache.reset(new CompilerCacheMock());
+
+    auto builtinCode = builtinsLib->getBuiltinCode(EBuiltInOps::copyBufferToBuffer, BuiltinCode::ECodeType::intermediate, *pDevice);
+    ASSERT_NE(0u, builtinCode.resource.size());
+
+    compilerInterface->igcRevision = "revision";
+    compilerInterface->igcLibSize = 1u;
+    compilerInterface->igcLibMTime = 1;
+    auto cacheKey = builtinsLib->loadCachedBinary(builtinCode, "-options", "-internal-options");
+    EXPECT_FALSE(cacheKey.empty());
+    EXPECT_EQ(cacheKey, builtinsLib->loadCachedBinary(builtinCode, "-options", "-internal-options"));
+    EXPECT_NE(cacheKey, builtinsLib->loadCachedBinary(builtinCode, "-options", "-other-internal-options"));
+
+    compilerInterface->igcRevision = "other revision";
+    EXPECT_NE(cacheKey, builtinsLib->loadCachedBinary(builtinCode, "-options", "-internal-options"));
+
+    compilerInterface->igcRevision = "revision";
+    compilerInterface->igcLibSize = 2u;
+    EXPECT_NE(cacheKey, builtinsLib->loadCachedBinary(builtinCode, "-options", "-internal-options"));
+
+    compilerInterface->igcLibSize = 1u;
+    compilerInterface->igcLibMTime = 2;
+    EXPECT_NE(cacheKey, builtinsLib->loadCachedBinary(builtinCode, "-options", "-internal-options"));
+}
+
+TEST_F(BuiltInSharedTest, givenBuiltinsBinaryCacheDisabledWhenLoadingCachedBinaryThenCodeIsNotChangedAndNoCacheKeyIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBuiltinsBinaryCache.set(0);
+    auto builtinsLib = std::make_unique<MockBuiltinsLib>();
+
+    auto builtinCode = builtinsLib->getBuiltinCode(EBuiltInOps::copyBufferToBuffer, BuiltinCode::ECodeType::intermediate, *pDevice);
+    auto resource = builtinCode.resource;
+
+    EXPECT_TRUE(builtinsLib->loadCachedBinary(builtinCode, "", "").empty());
+    EXPECT_EQ(BuiltinCode::ECodeType::intermediate, builtinCode.type);
+    EXPECT_EQ(resource, builtinCode.resource);
+    EXPECT_EQ(nullptr, builtinsLib->getBinaryCache());
+}
+
 HWTEST2_F(BuiltInSharedTest, GivenHeaplessModeEnabledWhenGetBuiltinResourceNamesIsCalledThenResourceNameIsCorrect, MatchAny) {
 
     class MockCompilerProductHelper : public CompilerProductHelperHw<productFamily> {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -436,7 +436,7 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAlloc
     cmdContainer.addToResidencyContainer(&mockAllocation);
     auto sizeAfterSecondAdd = cmdContainer.getResidencyContainer().size();
 
-    EXPECT_NE(sizeAfterFirstAdd, sizeAfterSecondAdd);
+    EXPECT_EQ(sizeAfterFirstAdd, sizeAfterSecondAdd);
 
     cmdContainer.removeDuplicatesFromResidencyContainer();
     auto sizeAfterDuplicatesRemoved = cmdContainer.getResidencyContainer().size();
@@ -444,6 +444,75 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAlloc
     EXPECT_EQ(sizeAfterFirstAdd, sizeAfterDuplicatesRemoved);
 }
 
+TEST_F(CommandContainerTest, givenAllocationsPushedDirectlyToResidencyContainerWhenAddingAndRemovingDuplicatesThenContainerIsUniqueAndOrderIsPreserved) {
+    CommandContainer cmdContainer;
+    MockGraphicsAllocation firstAllocation;
+    MockGraphicsAllocation secondAllocation;
+    MockGraphicsAllocation thirdAllocation;
+
+    cmdContainer.addToResidencyContainer(&firstAllocation);
+    cmdContainer.getResidencyContainer().push_back(&secondAllocation);
+    cmdContainer.getResidencyContainer().push_back(&firstAllocation);
+
+    cmdContainer.addToResidencyContainer(&secondAllocation);
+    cmdContainer.addToResidencyContainer(&thirdAllocation);
+
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    ASSERT_EQ(3u, residencyContainer.size());
+    EXPECT_EQ(&firstAllocation, residencyContainer[0]);
+    EXPECT_EQ(&secondAllocation, residencyContainer[1]);
+    EXPECT_EQ(&thirdAllocation, residencyContainer[2]);
+
+    residencyContainer.push_back(&thirdAllocation);
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+    EXPECT_EQ(3u, residencyContainer.size());
+}
+
+TEST_F(CommandContainerTest, givenAllocationRemovedOrContainerClearedWhenAddingAllocationAgainThenItIsAddedToResidencyContainer) {
+    CommandContainer cmdContainer;
+    MockGraphicsAllocation firstAllocation;
+    MockGraphicsAllocation secondAllocation;
+
+    cmdContainer.addToResidencyContainer(&firstAllocation);
+    cmdContainer.addToResidencyContainer(&secondAllocation);
+
+    cmdContainer.removeFromResidencyContainer(&firstAllocation);
+    ASSERT_EQ(1u, cmdContainer.getResidencyContainer().size());
+    EXPECT_EQ(&secondAllocation, cmdContainer.getResidencyContainer()[0]);
+
+    cmdContainer.addToResidencyContainer(&firstAllocation);
+    ASSERT_EQ(2u, cmdContainer.getResidencyContainer().size());
+    EXPECT_EQ(&firstAllocation, cmdContainer.getResidencyContainer()[1]);
+
+    cmdContainer.clearResidencyContainer();
+    EXPECT_EQ(0u, cmdContainer.getResidencyContainer().size());
+
+    cmdContainer.addToResidencyContainer(&firstAllocation);
+    cmdContainer.addToResidencyContainer(&secondAllocation);
+    EXPECT_EQ(2u, cmdContainer.getResidencyContainer().size());
+
+    cmdContainer.getResidencyContainer().clear();
+    cmdContainer.addToResidencyContainer(&secondAllocation);
+    ASSERT_EQ(1u, cmdContainer.getResidencyContainer().size());
+    EXPECT_EQ(&secondAllocation, cmdContainer.getResidencyContainer()[0]);
+}
+
+TEST_F(CommandContainerTest, givenAllocationReplacedThroughResidencyContainerWithoutSizeChangeWhenAddingReplacedAllocationThenItIsAddedAgain) {
+    CommandContainer cmdContainer;
+    MockGraphicsAllocation firstAllocation;
+    MockGraphicsAllocation secondAllocation;
+
+    cmdContainer.addToResidencyContainer(&firstAllocation);
+    cmdContainer.getResidencyContainer()[0] = &secondAllocation;
+    EXPECT_EQ(1u, cmdContainer.peekResidencyContainer().size());
+
+    cmdContainer.addToResidencyContainer(&firstAllocation);
+    cmdContainer.addToResidencyContainer(&secondAllocation);
+    ASSERT_EQ(2u, cmdContainer.peekResidencyContainer().size());
+    EXPECT_EQ(&secondAllocation, cmdContainer.peekResidencyContainer()[0]);
+    EXPECT_EQ(&firstAllocation, cmdContainer.peekResidencyContainer()[1]);
+}
+
 HWTEST_F(CommandContainerTest, givenCmdContainerWhenInitializeCalledThenSSHHeapHasBindlessOffsetReserved) {
     using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
     std::unique_ptr<CommandContainer> cmdContainer(new CommandContainer);
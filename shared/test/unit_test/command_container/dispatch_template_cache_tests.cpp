@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/dispatch_template_cache.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+struct MockWalkerTemplate {
+    uint32_t dwords[16];
+};
+
+TEST(DispatchTemplateCacheTest, givenEmptyCacheWhenFindingTemplateThenFalseIsReturned) {
+    DispatchTemplateCache cache;
+    DispatchTemplateKey key;
+    MockWalkerTemplate walker{};
+    EXPECT_FALSE(cache.find(key, walker));
+    EXPECT_EQ(0u, cache.size());
+}
+
+TEST(DispatchTemplateCacheTest, givenStoredTemplateWhenFindingWithSameKeyThenTemplateIsCopied) {
+    DispatchTemplateCache cache;
+    DispatchTemplateKey key;
+    key.kernelStartPointer = 0x1000u;
+    key.groupSize[0] = 32u;
+    key.groupCount[0] = 4u;
+
+    MockWalkerTemplate walker{};
+    for (uint32_t i = 0; i < 16; i++) {
+        walker.dwords[i] = i * 3;
+    }
+    cache.store(key, walker);
+    EXPECT_EQ(1u, cache.size());
+
+    MockWalkerTemplate found{};
+    EXPECT_TRUE(cache.find(key, found));
+    EXPECT_EQ(0, memcmp(&walker, &found, sizeof(MockWalkerTemplate)));
+
+    auto otherKey = key;
+    otherKey.groupCount[0] = 8u;
+    EXPECT_FALSE(cache.find(otherKey, found));
+
+    otherKey = key;
+    otherKey.partitioned = 1u;
+    EXPECT_FALSE(cache.find(otherKey, found));
+}
+
+TEST(DispatchTemplateCacheTest, givenFullCacheWhenStoringNewTemplateThenOldestEntryIsReplaced) {
+    DispatchTemplateCache cache;
+    MockWalkerTemplate walker{};
+    DispatchTemplateKey key;
+    for (uint32_t i = 0; i < DispatchTemplateCache::maxEntries; i++) {
+        key.groupSize[0] = i + 1;
+        walker.dwords[0] = i;
+        cache.store(key, walker);
+    }
+    EXPECT_EQ(DispatchTemplateCache::maxEntries, cache.size());
+
+    key.groupSize[0] = 0x100u;
+    walker.dwords[0] = 0x100u;
+    cache.store(key, walker);
+    EXPECT_EQ(DispatchTemplateCache::maxEntries, cache.size());
+
+    MockWalkerTemplate found{};
+    EXPECT_TRUE(cache.find(key, found));
+    EXPECT_EQ(0x100u, found.dwords[0]);
+
+    key.groupSize[0] = 1u;
+    EXPECT_FALSE(cache.find(key, found));
+    key.groupSize[0] = 2u;
+    EXPECT_TRUE(cache.find(key, found));
+    EXPECT_EQ(1u, found.dwords[0]);
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_FALSE(cache.find(key, found));
+}
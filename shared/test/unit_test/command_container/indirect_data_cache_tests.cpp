@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/indirect_data_cache.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+IndirectDataLocation createLocation(uintptr_t container, uintptr_t heapAllocation, uint64_t heapGeneration) {
+    IndirectDataLocation location;
+    location.container = reinterpret_cast<const CommandContainer *>(container);
+    location.heapAllocation = reinterpret_cast<const GraphicsAllocation *>(heapAllocation);
+    location.heapGeneration = heapGeneration;
+    return location;
+}
+} // namespace
+
+TEST(IndirectDataCacheTest, givenEmptyCacheWhenFindingPayloadThenFalseIsReturned) {
+    IndirectDataCache cache;
+    uint8_t crossThreadData[16] = {};
+    IndirectDataLocation found;
+    EXPECT_FALSE(cache.find(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), nullptr, 0u, found));
+    EXPECT_EQ(0u, cache.getReuseCount());
+}
+
+TEST(IndirectDataCacheTest, givenStoredPayloadWhenFindingSamePayloadInSameHeapThenStoredLocationIsReturned) {
+    IndirectDataCache cache;
+    uint8_t crossThreadData[16] = {1, 2, 3};
+    uint8_t perThreadData[8] = {4, 5};
+    auto location = createLocation(0x1000, 0x2000, 1u);
+    location.offsetThreadData = 0x340u;
+    location.cpuPtr = &crossThreadData;
+    cache.store(location, crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData));
+
+    IndirectDataLocation found;
+    EXPECT_TRUE(cache.find(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData), found));
+    EXPECT_EQ(0x340u, found.offsetThreadData);
+    EXPECT_EQ(location.cpuPtr, found.cpuPtr);
+    EXPECT_EQ(1u, cache.getReuseCount());
+    EXPECT_EQ(sizeof(crossThreadData) + sizeof(perThreadData), cache.getBytesSaved());
+}
+
+TEST(IndirectDataCacheTest, givenStoredPayloadWhenPayloadOrHeapChangesThenPayloadIsNotReused) {
+    IndirectDataCache cache;
+    uint8_t crossThreadData[16] = {1, 2, 3};
+    uint8_t perThreadData[8] = {4, 5};
+    cache.store(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData));
+
+    IndirectDataLocation found;
+    EXPECT_FALSE(cache.find(createLocation(0x1100, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData), found));
+    EXPECT_FALSE(cache.find(createLocation(0x1000, 0x2100, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData), found));
+    EXPECT_FALSE(cache.find(createLocation(0x1000, 0x2000, 2u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData), found));
+    EXPECT_FALSE(cache.find(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData) - 1, perThreadData, sizeof(perThreadData), found));
+    EXPECT_FALSE(cache.find(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, 0u, found));
+
+    perThreadData[7] = 6;
+    EXPECT_FALSE(cache.find(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData), found));
+    perThreadData[7] = 0;
+    crossThreadData[15] = 7;
+    EXPECT_FALSE(cache.find(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData), found));
+    crossThreadData[15] = 0;
+    EXPECT_TRUE(cache.find(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData), found));
+
+    cache.invalidate();
+    EXPECT_FALSE(cache.find(createLocation(0x1000, 0x2000, 1u), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData), found));
+    EXPECT_EQ(1u, cache.getReuseCount());
+}
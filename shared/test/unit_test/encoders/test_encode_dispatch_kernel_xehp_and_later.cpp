@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/command_container/dispatch_template_cache.h"
+#include "shared/source/command_container/indirect_data_cache.h"
 #include "shared/source/command_container/encode_surface_state.h"
 #include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_container/walker_partition_xehp_and_later.h"
@@ -552,6 +554,191 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenForceBtpPrefetchModeD
     }
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDispatchTemplateCacheWhenEncodingSameDispatchTwiceThenTemplateIsReusedAndWalkersMatch) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableDispatchTemplateCache.set(1);
+    uint32_t dims[] = {4, 2, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    DispatchTemplateCache dispatchTemplateCache;
+    dispatchInterface->getDispatchTemplateCacheResult = &dispatchTemplateCache;
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(1u, dispatchTemplateCache.size());
+    auto getIsaAllocationCalledAfterFirstEncode = dispatchInterface->getIsaAllocationCalled;
+
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(1u, dispatchTemplateCache.size());
+    EXPECT_EQ(1u, dispatchInterface->getIsaAllocationCalled - getIsaAllocationCalledAfterFirstEncode);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto walkers = findAll<DefaultWalkerType *>(commands.begin(), commands.end());
+    ASSERT_EQ(2u, walkers.size());
+
+    auto firstWalker = genCmdCast<DefaultWalkerType *>(*walkers[0]);
+    auto secondWalker = genCmdCast<DefaultWalkerType *>(*walkers[1]);
+    EXPECT_EQ(0, memcmp(&firstWalker->getInterfaceDescriptor(), &secondWalker->getInterfaceDescriptor(), sizeof(firstWalker->getInterfaceDescriptor())));
+    EXPECT_EQ(firstWalker->getThreadGroupIdXDimension(), secondWalker->getThreadGroupIdXDimension());
+    EXPECT_EQ(firstWalker->getThreadGroupIdYDimension(), secondWalker->getThreadGroupIdYDimension());
+    EXPECT_EQ(firstWalker->getExecutionMask(), secondWalker->getExecutionMask());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDispatchTemplateCacheWhenGroupSizeOrGroupCountChangesThenNewTemplateIsStored) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableDispatchTemplateCache.set(1);
+    uint32_t dims[] = {4, 2, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    DispatchTemplateCache dispatchTemplateCache;
+    dispatchInterface->getDispatchTemplateCacheResult = &dispatchTemplateCache;
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(1u, dispatchTemplateCache.size());
+
+    dims[0] = 8;
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(2u, dispatchTemplateCache.size());
+
+    dispatchInterface->groupSizes[0] = 16;
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(3u, dispatchTemplateCache.size());
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto walkers = findAll<DefaultWalkerType *>(commands.begin(), commands.end());
+    ASSERT_EQ(3u, walkers.size());
+    EXPECT_EQ(4u, genCmdCast<DefaultWalkerType *>(*walkers[0])->getThreadGroupIdXDimension());
+    EXPECT_EQ(8u, genCmdCast<DefaultWalkerType *>(*walkers[1])->getThreadGroupIdXDimension());
+    EXPECT_EQ(8u, genCmdCast<DefaultWalkerType *>(*walkers[2])->getThreadGroupIdXDimension());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDispatchTemplateCacheDisabledOrIndirectDispatchWhenEncodingThenCacheIsNotUsed) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restorer;
+    uint32_t dims[] = {4, 2, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    DispatchTemplateCache dispatchTemplateCache;
+    dispatchInterface->getDispatchTemplateCacheResult = &dispatchTemplateCache;
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(0u, dispatchTemplateCache.size());
+
+    debugManager.flags.EnableDispatchTemplateCache.set(0);
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(0u, dispatchTemplateCache.size());
+
+    debugManager.flags.EnableDispatchTemplateCache.set(1);
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    dispatchArgs.isIndirect = true;
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(0u, dispatchTemplateCache.size());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenSlmSizeOverrideOrDebuggerWhenGettingDispatchTemplateKeyThenKeyChanges) {
+    DebugManagerStateRestore restorer;
+    uint32_t dims[] = {4, 2, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    DispatchTemplateKey defaultKey;
+    EncodeDispatchKernel<FamilyType>::getDispatchTemplateKey(defaultKey, dispatchArgs);
+
+    debugManager.flags.OverrideSlmAllocationSize.set(4);
+    DispatchTemplateKey slmOverrideKey;
+    EncodeDispatchKernel<FamilyType>::getDispatchTemplateKey(slmOverrideKey, dispatchArgs);
+    EXPECT_FALSE(defaultKey == slmOverrideKey);
+
+    debugManager.flags.OverrideSlmAllocationSize.set(-1);
+    pDevice->getRootDeviceEnvironmentRef().debugger.reset(new MockDebuggerL0(pDevice));
+    DispatchTemplateKey debuggerKey;
+    EncodeDispatchKernel<FamilyType>::getDispatchTemplateKey(debuggerKey, dispatchArgs);
+    EXPECT_FALSE(defaultKey == debuggerKey);
+    EXPECT_FALSE(slmOverrideKey == debuggerKey);
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenIndirectDataCacheWhenEncodingUnchangedPayloadTwiceThenIndirectDataIsWrittenOnce) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIndirectDataReuse.set(1);
+    uint32_t dims[] = {4, 2, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    IndirectDataCache indirectDataCache;
+    dispatchInterface->getIndirectDataCacheResult = &indirectDataCache;
+    auto ioh = cmdContainer->getIndirectHeap(HeapType::indirectObject);
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    auto iohUsedAfterFirstEncode = ioh->getUsed();
+    auto firstIndirectData = dispatchArgs.outIndirectDataPtr;
+    EXPECT_NE(nullptr, firstIndirectData);
+
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(iohUsedAfterFirstEncode, ioh->getUsed());
+    EXPECT_EQ(firstIndirectData, dispatchArgs.outIndirectDataPtr);
+    EXPECT_EQ(1u, indirectDataCache.getReuseCount());
+    EXPECT_NE(0u, indirectDataCache.getBytesSaved());
+
+    dispatchInterface->dataCrossThread[MockDispatchKernelEncoder::crossThreadSize - 1] ^= 0xff;
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_LT(iohUsedAfterFirstEncode, ioh->getUsed());
+    EXPECT_NE(firstIndirectData, dispatchArgs.outIndirectDataPtr);
+    EXPECT_EQ(1u, indirectDataCache.getReuseCount());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenIndirectDataCacheWhenReuseIsNotEnabledOrContainerIsResetThenIndirectDataIsWrittenAgain) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restorer;
+    uint32_t dims[] = {4, 2, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    IndirectDataCache indirectDataCache;
+    dispatchInterface->getIndirectDataCacheResult = &indirectDataCache;
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(0u, indirectDataCache.getReuseCount());
+
+    debugManager.flags.EnableIndirectDataReuse.set(1);
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    dispatchArgs.requiresExclusiveIndirectData = true;
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(0u, indirectDataCache.getReuseCount());
+
+    debugManager.flags.EnableIndirectDataReuse.set(0);
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(0u, indirectDataCache.getReuseCount());
+
+    debugManager.flags.EnableIndirectDataReuse.set(1);
+    cmdContainer->reset();
+    auto ioh = cmdContainer->getIndirectHeap(HeapType::indirectObject);
+    auto iohUsedBefore = ioh->getUsed();
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_LT(iohUsedBefore, ioh->getUsed());
+    EXPECT_EQ(0u, indirectDataCache.getReuseCount());
+}
+
 HWTEST2_F(CommandEncodeStatesTest, givenDispatchInterfaceWhenNumRequiredGrfIsNotDefaultThenStateComputeModeCommandAdded, MatchAny) {
     DebugManagerStateRestore restorer;
     debugManager.flags.ForceGrfNumProgrammingWithScm.set(1);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -252,6 +252,19 @@ TEST(ExecutionEnvironment, givenEnableDirectSubmissionControllerSetZeroWhenIniti
     EXPECT_EQ(controller, nullptr);
 }
 
+TEST(ExecutionEnvironment, givenParallelCpuCopyFlagWhenInitializeCpuCopyEngineThenEngineIsCreatedOnlyWhenEnabled) {
+    DebugManagerStateRestore restorer;
+    VariableBackup<decltype(NEO::Thread::createFunc)> funcBackup{&NEO::Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> { return nullptr; }};
+    MockExecutionEnvironment executionEnvironment{};
+
+    EXPECT_EQ(nullptr, executionEnvironment.initializeCpuCopyEngine());
+
+    debugManager.flags.EnableParallelCpuCopy.set(1);
+    auto cpuCopyEngine = executionEnvironment.initializeCpuCopyEngine();
+    EXPECT_NE(nullptr, cpuCopyEngine);
+    EXPECT_EQ(cpuCopyEngine, executionEnvironment.initializeCpuCopyEngine());
+}
+
 TEST(ExecutionEnvironment, givenNeoCalEnabledWhenCreateExecutionEnvironmentThenSetDebugVariables) {
     const std::unordered_map<std::string, int32_t> config = {
         {"UseKmdMigration", 0},
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,7 @@ EncodeDispatchKernelArgs CommandEncodeStatesFixture::createDefaultDispatchKernel
         nullptr,                                    // cpuWalkerBuffer
         nullptr,                                    // cpuPayloadBuffer
         nullptr,                                    // outImplicitArgsPtr
+        nullptr,                                    // outIndirectDataPtr
         nullptr,                                    // additionalCommands
         PreemptionMode::Disabled,                   // preemptionMode
         NEO::RequiredPartitionDim::none,            // requiredPartitionDim
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -390,7 +390,7 @@ TEST(KernelDescriptorFromPatchtokens, GivenPrintfStringThenPopulatesStringsMapIn
     NEO::KernelDescriptor kernelDescriptor;
 
     NEO::populateKernelDescriptor(kernelDescriptor, kernelTokens, 4);
-    EXPECT_TRUE(kernelDescriptor.kernelMetadata.printfStringsMap.empty());
+    EXPECT_TRUE(kernelDescriptor.kernelMetadata.printfStringsMap->empty());
 
     std::vector<uint8_t> strTokStream;
     std::string str0{"some_string0"};
@@ -408,11 +408,11 @@ TEST(KernelDescriptorFromPatchtokens, GivenPrintfStringThenPopulatesStringsMapIn
     kernelTokens.tokens.strings.push_back(reinterpret_cast<iOpenCL::SPatchString *>(strTokStream.data() + string3Off));
 
     NEO::populateKernelDescriptor(kernelDescriptor, kernelTokens, 4);
-    ASSERT_EQ(4U, kernelDescriptor.kernelMetadata.printfStringsMap.size());
-    EXPECT_EQ(str0, kernelDescriptor.kernelMetadata.printfStringsMap[0]);
-    EXPECT_EQ(str1, kernelDescriptor.kernelMetadata.printfStringsMap[2]);
-    EXPECT_EQ(str2, kernelDescriptor.kernelMetadata.printfStringsMap[1]);
-    EXPECT_TRUE(kernelDescriptor.kernelMetadata.printfStringsMap[3].empty());
+    ASSERT_EQ(4U, kernelDescriptor.kernelMetadata.printfStringsMap->size());
+    EXPECT_EQ(str0, (*kernelDescriptor.kernelMetadata.printfStringsMap)[0]);
+    EXPECT_EQ(str1, (*kernelDescriptor.kernelMetadata.printfStringsMap)[2]);
+    EXPECT_EQ(str2, (*kernelDescriptor.kernelMetadata.printfStringsMap)[1]);
+    EXPECT_TRUE((*kernelDescriptor.kernelMetadata.printfStringsMap)[3].empty());
 }
 
 TEST(KernelDescriptorFromPatchtokens, GivenPureStatlessAddressingMdelThenBindfulOffsetIsLeftUndefined) {
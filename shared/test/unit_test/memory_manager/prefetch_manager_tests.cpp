@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/memory_manager/mock_prefetch_manager.h"
@@ -86,3 +87,115 @@ TEST(PrefetchManagerTests, givenPrefetchManagerWhenCallingMigrateAllocationsToGp
     EXPECT_TRUE(prefetchManager->migrateAllocationsToGpuCalled);
     EXPECT_FALSE(svmManager->prefetchMemoryCalled);
 }
+
+TEST(PrefetchManagerTests, givenKernelRepeatedlyUsingSharedAllocationWhenRecordingKernelExecutionsThenAllocationIsPredictedBeforeNextExecution) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+    KernelDescriptor kernelDescriptor;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, ptr);
+    auto svmData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, svmData);
+
+    ResidencyContainer kernelAllocations = {svmData->gpuAllocations.getDefaultGraphicsAllocation(), nullptr};
+    prefetchManager->recordKernelLaunch(prefetchContext, kernelDescriptor, kernelAllocations, *svmManager);
+    ASSERT_EQ(1u, prefetchContext.kernelLaunches.size());
+    EXPECT_EQ(0u, prefetchContext.allocations.size());
+
+    EXPECT_TRUE(prefetchManager->recordKernelExecutions(prefetchContext).empty());
+
+    auto hotAllocations = prefetchManager->recordKernelExecutions(prefetchContext);
+    ASSERT_EQ(1u, hotAllocations.size());
+    EXPECT_EQ(ptr, hotAllocations[0]);
+    EXPECT_EQ(0u, prefetchContext.allocations.size());
+
+    PrefetchContext otherPrefetchContext;
+    ResidencyContainer otherAllocations = {};
+    prefetchManager->recordKernelLaunch(otherPrefetchContext, kernelDescriptor, otherAllocations, *svmManager);
+    EXPECT_EQ(1u, prefetchManager->recordKernelExecutions(otherPrefetchContext).size());
+
+    auto statistics = prefetchManager->getStatistics();
+    EXPECT_EQ(2u, statistics.predictedAllocations);
+    EXPECT_EQ(1u, statistics.usedPredictions);
+    EXPECT_EQ(1u, statistics.unusedPredictions);
+    EXPECT_EQ(0u, statistics.skippedCpuBoundAllocations);
+
+    prefetchManager->removeKernelLaunches(prefetchContext);
+    EXPECT_EQ(0u, prefetchContext.kernelLaunches.size());
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST(PrefetchManagerTests, givenSharedAllocationFaultingBackToCpuAfterEachExecutionWhenRecordingKernelExecutionsThenAllocationIsNotPredicted) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+    KernelDescriptor kernelDescriptor;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, ptr);
+    auto svmData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, svmData);
+
+    ResidencyContainer kernelAllocations = {svmData->gpuAllocations.getDefaultGraphicsAllocation()};
+    prefetchManager->recordKernelLaunch(prefetchContext, kernelDescriptor, kernelAllocations, *svmManager);
+
+    EXPECT_TRUE(prefetchManager->recordKernelExecutions(prefetchContext).empty());
+    prefetchManager->recordCpuFault(ptr);
+    EXPECT_TRUE(prefetchManager->recordKernelExecutions(prefetchContext).empty());
+    prefetchManager->recordCpuFault(ptr);
+
+    auto statistics = prefetchManager->getStatistics();
+    EXPECT_EQ(0u, statistics.predictedAllocations);
+    EXPECT_EQ(1u, statistics.skippedCpuBoundAllocations);
+    EXPECT_EQ(2u, statistics.cpuFaults);
+
+    prefetchManager->removeAllocationHistory(ptr);
+    EXPECT_TRUE(prefetchManager->recordKernelExecutions(prefetchContext).empty());
+    EXPECT_EQ(1u, prefetchManager->getStatistics().skippedCpuBoundAllocations);
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST(PrefetchManagerTests, givenKernelHistoryRemovedWhenRecordingKernelExecutionsForSameDescriptorAddressThenPreviousHistoryIsNotUsed) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    auto prefetchManager = std::make_unique<MockPrefetchManager>();
+    PrefetchContext prefetchContext;
+    KernelDescriptor kernelDescriptor;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::sharedUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, ptr);
+    auto svmData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, svmData);
+
+    ResidencyContainer kernelAllocations = {svmData->gpuAllocations.getDefaultGraphicsAllocation()};
+    prefetchManager->recordKernelLaunch(prefetchContext, kernelDescriptor, kernelAllocations, *svmManager);
+    prefetchManager->recordKernelExecutions(prefetchContext);
+    prefetchManager->removeKernelLaunches(prefetchContext);
+
+    prefetchManager->removeKernelHistory(kernelDescriptor);
+
+    ResidencyContainer otherAllocations = {};
+    prefetchManager->recordKernelLaunch(prefetchContext, kernelDescriptor, otherAllocations, *svmManager);
+    EXPECT_TRUE(prefetchManager->recordKernelExecutions(prefetchContext).empty());
+    EXPECT_EQ(0u, prefetchManager->getStatistics().predictedAllocations);
+
+    svmManager->freeSVMAlloc(ptr);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -5057,6 +5057,78 @@ HWTEST2_F(DrmMemoryManagerTest, givenDrmAllocationWithWithAlignmentFromUserptrWh
     EXPECT_EQ(allocation, nullptr);
 }
 
+TEST(DrmMemoryManagerNumaPlacementTest, givenDeviceLocalNumaPlacementModeWhenCheckingAllocationThenOnlyInternalAndOptionallyUsmHostAllocationsAreCandidates) {
+    DebugManagerStateRestore restorer;
+    AllocationData allocationData{};
+    allocationData.type = AllocationType::commandBuffer;
+
+    EXPECT_FALSE(DrmMemoryManager::isDeviceLocalNumaPlacementCandidate(allocationData));
+
+    debugManager.flags.EnableDeviceLocalNumaPlacement.set(1);
+    EXPECT_TRUE(DrmMemoryManager::isDeviceLocalNumaPlacementCandidate(allocationData));
+    allocationData.type = AllocationType::buffer;
+    EXPECT_FALSE(DrmMemoryManager::isDeviceLocalNumaPlacementCandidate(allocationData));
+    allocationData.type = AllocationType::svmCpu;
+    allocationData.flags.isUSMHostAllocation = true;
+    EXPECT_FALSE(DrmMemoryManager::isDeviceLocalNumaPlacementCandidate(allocationData));
+
+    debugManager.flags.EnableDeviceLocalNumaPlacement.set(2);
+    EXPECT_TRUE(DrmMemoryManager::isDeviceLocalNumaPlacementCandidate(allocationData));
+}
+
+TEST_F(DrmMemoryManagerTest, givenHostAllocationHugePagesEnabledWhenCreatingUserptrAllocationAboveThresholdThenHugePagesAreAdvisedForAlignedStorage) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostAllocationHugePages.set(1);
+    mock->ioctlExpected.total = -1;
+
+    static void *advisedPtr = nullptr;
+    static size_t advisedSize = 0u;
+    static int advice = 0;
+    VariableBackup<decltype(SysCalls::sysCallsMadvise)> mockMadvise(&SysCalls::sysCallsMadvise, [](void *addr, size_t size, int adv) -> int {
+        advisedPtr = addr;
+        advisedSize = size;
+        advice = adv;
+        return 0;
+    });
+    VariableBackup<uint32_t> madviseCalledBackup(&SysCalls::madviseFuncCalled, 0u);
+
+    auto size = 4 * MemoryConstants::megaByte;
+    allocationData.size = size;
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize2M>(allocation->getUnderlyingBuffer()));
+    EXPECT_EQ(1u, SysCalls::madviseFuncCalled);
+    EXPECT_EQ(allocation->getUnderlyingBuffer(), advisedPtr);
+    EXPECT_EQ(size, advisedSize);
+    EXPECT_EQ(MADV_HUGEPAGE, advice);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    size = 2 * MemoryConstants::megaByte;
+    allocationData.size = size;
+    allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(1u, SysCalls::madviseFuncCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    debugManager.flags.HostAllocationHugePagesThreshold.set(static_cast<int32_t>(size));
+    allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(2u, SysCalls::madviseFuncCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHostAllocationHugePagesDisabledWhenCreatingLargeUserptrAllocationThenHugePagesAreNotAdvised) {
+    mock->ioctlExpected.total = -1;
+    VariableBackup<uint32_t> madviseCalledBackup(&SysCalls::madviseFuncCalled, 0u);
+
+    auto size = 4 * MemoryConstants::megaByte;
+    allocationData.size = size;
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(0u, SysCalls::madviseFuncCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenAllocateGraphicsMemoryWithPropertiesCalledWithDebugSurfaceTypeThenDebugSurfaceIsCreated) {
     AllocationProperties debugSurfaceProperties{0, true, MemoryConstants::pageSize, NEO::AllocationType::debugContextSaveArea, false, false, 0b1011};
     auto debugSurface = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(debugSurfaceProperties));
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -159,6 +159,51 @@ TEST(DrmTest, GivenValidSysfsNodeWhenGetDeviceMemoryPhysicalSizeInBytesIsCalledT
     EXPECT_EQ(2048u, size);
 }
 
+TEST(DrmTest, GivenNumaNodeSysfsEntryWhenGetDeviceNumaNodeIsCalledThenNodeIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("1\n");
+        memcpy(buf, testData.data(), testData.length() + 1);
+        return 2;
+    });
+    auto numaNode = drm.getDeviceNumaNode();
+    ASSERT_TRUE(numaNode.has_value());
+    EXPECT_EQ(1u, numaNode.value());
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.OverrideDeviceNumaNode.set(3);
+    EXPECT_EQ(3u, drm.getDeviceNumaNode().value());
+}
+
+TEST(DrmTest, GivenNumaNodeSysfsEntryWithoutAffinityWhenGetDeviceNumaNodeIsCalledThenNoNodeIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return 1;
+    });
+
+    VariableBackup<decltype(SysCalls::sysCallsPread)> mockPread(&SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+        const std::string testData("-1\n");
+        memcpy(buf, testData.data(), testData.length() + 1);
+        return 3;
+    });
+    EXPECT_FALSE(drm.getDeviceNumaNode().has_value());
+
+    mockOpen = [](const char *pathname, int flags) -> int {
+        return -1;
+    };
+    EXPECT_FALSE(drm.getDeviceNumaNode().has_value());
+}
+
 TEST(DrmTest, GivenInValidSysfsNodeWhenGetDeviceMemoryMaxClockRateInMhzIsCalledThenReturnSuccess) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,12 +20,15 @@ struct WhiteBoxNumaLibrary : NumaLibrary {
   public:
     using NumaLibrary::numaLibNameStr;
     using NumaLibrary::procGetMemPolicyStr;
+    using NumaLibrary::procMbindStr;
     using NumaLibrary::procNumaAvailableStr;
     using NumaLibrary::procNumaMaxNodeStr;
     using GetMemPolicyPtr = NumaLibrary::GetMemPolicyPtr;
     using NumaAvailablePtr = NumaLibrary::NumaAvailablePtr;
     using NumaMaxNodePtr = NumaLibrary::NumaMaxNodePtr;
+    using MbindPtr = NumaLibrary::MbindPtr;
     using NumaLibrary::getMemPolicyFunction;
+    using NumaLibrary::mbindFunction;
     using NumaLibrary::osLibrary;
 };
 
@@ -141,3 +144,74 @@ TEST(NumaLibraryTests, givenNumaLibraryWithInvalidGetMemPolicyWhenCallingGetMemP
     MockOsLibrary::loadLibraryNewObject = nullptr;
     WhiteBoxNumaLibrary::osLibrary.reset();
 }
+
+TEST(NumaLibraryTests, givenNumaLibraryWithMbindWhenBindingMemoryToNodeThenPreferredPolicyWithNodeMaskIsRequested) {
+    static int mbindMode = -1;
+    static unsigned long mbindNodeMask = 0;
+    static unsigned long mbindMaxNode = 0;
+    static unsigned int mbindFlags = 0;
+    WhiteBoxNumaLibrary::GetMemPolicyPtr memPolicyHandler =
+        [](int *, unsigned long[], unsigned long, void *, unsigned long) -> long { return 0; };
+    WhiteBoxNumaLibrary::NumaAvailablePtr numaAvailableHandler =
+        [](void) -> int { return 0; };
+    WhiteBoxNumaLibrary::NumaMaxNodePtr numaMaxNodeHandler =
+        [](void) -> int { return 3; };
+    WhiteBoxNumaLibrary::MbindPtr mbindHandler =
+        [](void *, unsigned long, int mode, const unsigned long *nodeMask, unsigned long maxNode, unsigned int flags) -> long {
+        mbindMode = mode;
+        mbindNodeMask = nodeMask[0];
+        mbindMaxNode = maxNode;
+        mbindFlags = flags;
+        return 0;
+    };
+    MockOsLibrary::loadLibraryNewObject = new MockOsLibraryCustom(nullptr, true);
+    MockOsLibraryCustom *osLibrary = static_cast<MockOsLibraryCustom *>(MockOsLibrary::loadLibraryNewObject);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procGetMemPolicyStr)] = reinterpret_cast<void *>(memPolicyHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaAvailableStr)] = reinterpret_cast<void *>(numaAvailableHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaMaxNodeStr)] = reinterpret_cast<void *>(numaMaxNodeHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procMbindStr)] = reinterpret_cast<void *>(mbindHandler);
+
+    VariableBackup<decltype(NEO::OsLibrary::loadFunc)> funcBackup{&NEO::OsLibrary::loadFunc, MockOsLibraryCustom::load};
+    EXPECT_TRUE(WhiteBoxNumaLibrary::init());
+    EXPECT_EQ(mbindHandler, WhiteBoxNumaLibrary::mbindFunction);
+
+    std::vector<unsigned long> nodeMask;
+    EXPECT_FALSE(WhiteBoxNumaLibrary::getNodeMask(4, nodeMask));
+    EXPECT_TRUE(WhiteBoxNumaLibrary::getNodeMask(2, nodeMask));
+    EXPECT_EQ(0b100ul, nodeMask[0]);
+
+    int value = 0;
+    EXPECT_FALSE(WhiteBoxNumaLibrary::bindMemoryToNode(&value, sizeof(value), 4));
+    EXPECT_TRUE(WhiteBoxNumaLibrary::bindMemoryToNode(&value, sizeof(value), 1));
+    EXPECT_EQ(WhiteBoxNumaLibrary::mpolPreferred, mbindMode);
+    EXPECT_EQ(0b10ul, mbindNodeMask);
+    EXPECT_EQ(5ul, mbindMaxNode);
+    EXPECT_EQ(WhiteBoxNumaLibrary::mpolMfMove, mbindFlags);
+
+    MockOsLibrary::loadLibraryNewObject = nullptr;
+    WhiteBoxNumaLibrary::osLibrary.reset();
+}
+
+TEST(NumaLibraryTests, givenNumaLibraryWithoutMbindWhenBindingMemoryToNodeThenFalseIsReturned) {
+    WhiteBoxNumaLibrary::GetMemPolicyPtr memPolicyHandler =
+        [](int *, unsigned long[], unsigned long, void *, unsigned long) -> long { return 0; };
+    WhiteBoxNumaLibrary::NumaAvailablePtr numaAvailableHandler =
+        [](void) -> int { return 0; };
+    WhiteBoxNumaLibrary::NumaMaxNodePtr numaMaxNodeHandler =
+        [](void) -> int { return 1; };
+    MockOsLibrary::loadLibraryNewObject = new MockOsLibraryCustom(nullptr, true);
+    MockOsLibraryCustom *osLibrary = static_cast<MockOsLibraryCustom *>(MockOsLibrary::loadLibraryNewObject);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procGetMemPolicyStr)] = reinterpret_cast<void *>(memPolicyHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaAvailableStr)] = reinterpret_cast<void *>(numaAvailableHandler);
+    osLibrary->procMap[std::string(WhiteBoxNumaLibrary::procNumaMaxNodeStr)] = reinterpret_cast<void *>(numaMaxNodeHandler);
+
+    VariableBackup<decltype(NEO::OsLibrary::loadFunc)> funcBackup{&NEO::OsLibrary::loadFunc, MockOsLibraryCustom::load};
+    EXPECT_TRUE(WhiteBoxNumaLibrary::init());
+    EXPECT_EQ(nullptr, WhiteBoxNumaLibrary::mbindFunction);
+
+    int value = 0;
+    EXPECT_FALSE(WhiteBoxNumaLibrary::bindMemoryToNode(&value, sizeof(value), 0));
+
+    MockOsLibrary::loadLibraryNewObject = nullptr;
+    WhiteBoxNumaLibrary::osLibrary.reset();
+}
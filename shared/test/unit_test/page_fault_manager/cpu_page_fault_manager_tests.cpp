@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -894,3 +894,63 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenBatchedMigrationEnabledWhenMovingAdjacentAllocsToGpuDomainThenCpuAccessIsProtectedWithCoalescedRanges) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ExperimentalBatchedUmdSharedMigration.set(1);
+
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x11000);
+    void *alloc3 = reinterpret_cast<void *>(0x20000);
+
+    pageFaultManager->insertAllocation(alloc3, 10, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 20, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc1, MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+
+    EXPECT_EQ(3, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(2, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(alloc3, pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    auto statistics = pageFaultManager->getStatistics();
+    EXPECT_EQ(3u, statistics.protectedRanges);
+    EXPECT_EQ(2u, statistics.coalescedProtectCalls);
+}
+
+TEST_F(PageFaultManagerTest, givenBatchedMigrationEnabledWhenFaultingOnAllocAccessedTogetherWithOthersThenWholeGroupIsMigratedToCpu) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ExperimentalBatchedUmdSharedMigration.set(1);
+
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x20000);
+    void *alloc3 = reinterpret_cast<void *>(0x30000);
+
+    pageFaultManager->insertAllocation(alloc1, 10, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 10, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc3, 10, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc1));
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc2));
+    EXPECT_EQ(2, pageFaultManager->transferToCpuCalled);
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc2));
+    EXPECT_EQ(4, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc1).domain, PageFaultManager::AllocationDomain::cpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).domain, PageFaultManager::AllocationDomain::cpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc3).domain, PageFaultManager::AllocationDomain::gpu);
+
+    auto statistics = pageFaultManager->getStatistics();
+    EXPECT_EQ(3u, statistics.cpuFaults);
+    EXPECT_EQ(1u, statistics.groupMigrations);
+
+    uint64_t faultsInHistogram = 0;
+    for (auto bucket : statistics.faultLatencyHistogramUs) {
+        faultsInHistogram += bucket;
+    }
+    EXPECT_EQ(3u, faultsInHistogram);
+}
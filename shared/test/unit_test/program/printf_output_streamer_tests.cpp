@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/printf_output_streamer.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> createPrintfBuffer(int value) {
+    const uint32_t words[] = {0u, 0u, static_cast<uint32_t>(PrintfDataType::intType), static_cast<uint32_t>(value)};
+    std::vector<uint8_t> buffer(1024u, 0u);
+    memcpy(buffer.data(), words, sizeof(words));
+    const uint32_t usedSize = sizeof(words);
+    memcpy(buffer.data(), &usedSize, sizeof(usedSize));
+    return buffer;
+}
+} // namespace
+
+TEST(PrintfOutputStreamerTest, givenRunningThreadWhenBuffersAreSubmittedThenSnapshotsAreDecodedInOrderAndRecycled) {
+    auto stringLiteralMap = std::make_shared<const StringMap>(StringMap{{0u, "value %d\n"}});
+    std::string output;
+
+    PrintfOutputStreamer streamer;
+    streamer.setSink([&output](char *str) { output += str; });
+    streamer.startThread();
+    ASSERT_TRUE(streamer.isThreadRunning());
+
+    for (int value : {1, 2, 3}) {
+        auto buffer = createPrintfBuffer(value);
+        streamer.submit(buffer.data(), static_cast<uint32_t>(buffer.size()), false, stringLiteralMap);
+        // the printf surface may be reset and reused as soon as it was submitted
+        std::fill(buffer.begin(), buffer.end(), static_cast<uint8_t>(0xff));
+    }
+    streamer.drain();
+
+    EXPECT_EQ("value 1\nvalue 2\nvalue 3\n", output);
+    EXPECT_EQ(0u, streamer.getPendingCount());
+    EXPECT_LE(1u, streamer.getSpareSnapshotCount());
+    EXPECT_GE(PrintfOutputStreamer::maxSpareSnapshots, streamer.getSpareSnapshotCount());
+
+    streamer.stopThread();
+    EXPECT_FALSE(streamer.isThreadRunning());
+}
+
+TEST(PrintfOutputStreamerTest, givenStringMapReleasedByOwnerAfterSubmitWhenDecodingThenSharedMapIsUsedAndReleasedAfterDecode) {
+    std::string output;
+
+    PrintfOutputStreamer streamer;
+    streamer.setSink([&output](char *str) { output += str; });
+    streamer.startThread();
+
+    std::weak_ptr<const StringMap> weakStringLiteralMap;
+    {
+        auto stringLiteralMap = std::make_shared<const StringMap>(StringMap{{0u, "value %d\n"}});
+        weakStringLiteralMap = stringLiteralMap;
+        auto buffer = createPrintfBuffer(42);
+        streamer.submit(buffer.data(), static_cast<uint32_t>(buffer.size()), false, stringLiteralMap);
+    }
+    streamer.drain();
+
+    EXPECT_EQ("value 42\n", output);
+    EXPECT_TRUE(weakStringLiteralMap.expired());
+}
+
+TEST(PrintfOutputStreamerTest, givenThreadNotStartedWhenBufferIsSubmittedThenItIsDecodedOnCallingThread) {
+    auto stringLiteralMap = std::make_shared<const StringMap>(StringMap{{0u, "value %d\n"}});
+    std::string output;
+
+    PrintfOutputStreamer streamer;
+    streamer.setSink([&output](char *str) { output += str; });
+
+    auto buffer = createPrintfBuffer(5);
+    streamer.submit(buffer.data(), static_cast<uint32_t>(buffer.size()), false, stringLiteralMap);
+
+    EXPECT_EQ("value 5\n", output);
+    EXPECT_EQ(0u, streamer.getPendingCount());
+    EXPECT_EQ(1u, streamer.getSpareSnapshotCount());
+}
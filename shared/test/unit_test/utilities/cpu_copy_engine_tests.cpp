@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy_engine.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace CpuIntrinsicsTests {
+extern std::atomic<uint32_t> sfenceCounter;
+extern std::atomic<uint32_t> streamingCopyCounter;
+} // namespace CpuIntrinsicsTests
+
+using namespace NEO;
+
+namespace {
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    return pattern;
+}
+} // namespace
+
+TEST(CpuCopyEngineTest, givenDebugFlagsWhenCreatingEngineThenThresholdsAndWorkerCountAreOverridden) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ParallelCpuCopyWorkerCount.set(3);
+    debugManager.flags.ParallelCpuCopyThreshold.set(64 * 1024);
+    debugManager.flags.CpuCopyStreamingStoresThreshold.set(4096);
+
+    CpuCopyEngine cpuCopyEngine;
+    EXPECT_EQ(64u * 1024u, cpuCopyEngine.getParallelThreshold());
+    EXPECT_EQ(4096u, cpuCopyEngine.getStreamingStoresThreshold());
+
+    cpuCopyEngine.startThreads();
+    EXPECT_EQ(3u, cpuCopyEngine.getWorkerCount());
+    cpuCopyEngine.stopThreads();
+    EXPECT_EQ(0u, cpuCopyEngine.getWorkerCount());
+}
+
+TEST(CpuCopyEngineTest, givenCopyAboveParallelThresholdWhenCopyingThenDataIsSplitAcrossWorkersAndCopiedCorrectly) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ParallelCpuCopyWorkerCount.set(3);
+    debugManager.flags.ParallelCpuCopyThreshold.set(64 * 1024);
+
+    CpuCopyEngine cpuCopyEngine;
+    cpuCopyEngine.startThreads();
+
+    for (auto size : {CpuCopyEngine::minSliceSize * 4 + 123, CpuCopyEngine::minSliceSize * 9 + 4097}) {
+        auto src = createPattern(size);
+        std::vector<uint8_t> dst(size, 0u);
+        cpuCopyEngine.copy(dst.data(), src.data(), size, false);
+        EXPECT_EQ(src, dst);
+    }
+    EXPECT_EQ(2u, cpuCopyEngine.getParallelCopiesCount());
+}
+
+TEST(CpuCopyEngineTest, givenCopyBelowParallelThresholdWhenCopyingThenCopyIsDoneOnCallingThread) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ParallelCpuCopyWorkerCount.set(2);
+
+    CpuCopyEngine cpuCopyEngine;
+    cpuCopyEngine.startThreads();
+
+    const size_t size = 4096u;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0u);
+    cpuCopyEngine.copy(dst.data(), src.data(), size, false);
+    EXPECT_EQ(src, dst);
+    EXPECT_EQ(0u, cpuCopyEngine.getParallelCopiesCount());
+}
+
+TEST(CpuCopyEngineTest, givenWriteCombinedDestinationWhenCopyingAboveStreamingThresholdThenStreamingStoresAreUsedAndFenced) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ParallelCpuCopyWorkerCount.set(0);
+    debugManager.flags.CpuCopyStreamingStoresThreshold.set(4096);
+
+    CpuCopyEngine cpuCopyEngine;
+    const size_t size = 8192u;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0u);
+
+    auto streamingCopies = CpuIntrinsicsTests::streamingCopyCounter.load();
+    auto sfences = CpuIntrinsicsTests::sfenceCounter.load();
+    cpuCopyEngine.copy(dst.data(), src.data(), size, false);
+    EXPECT_EQ(streamingCopies, CpuIntrinsicsTests::streamingCopyCounter.load());
+    EXPECT_EQ(sfences, CpuIntrinsicsTests::sfenceCounter.load());
+
+    cpuCopyEngine.copy(dst.data(), src.data(), 1024u, true);
+    EXPECT_EQ(streamingCopies, CpuIntrinsicsTests::streamingCopyCounter.load());
+
+    cpuCopyEngine.copy(dst.data(), src.data(), size, true);
+    EXPECT_EQ(streamingCopies + 1, CpuIntrinsicsTests::streamingCopyCounter.load());
+    EXPECT_EQ(sfences + 1, CpuIntrinsicsTests::sfenceCounter.load());
+    EXPECT_EQ(src, dst);
+}